@@ -19,32 +19,69 @@
 
 #include "opbdp_solve.hpp"
 #include "PBCS.h"
-// Not threadsafe
-static unsigned int ** opbdp_solution=NULL;
-static int opbdp_number_solutions=0;
-static int opbdp_maximum_solutions=0;
-static int size_solution=0;
-static PBCS *save_pbcs=NULL;
-void opbdp_save_solution(OrdInt & sol)
+#if defined(_MSC_VER)
+#define OPBDP_THREAD_LOCAL __declspec(thread)
+#else
+#define OPBDP_THREAD_LOCAL __thread
+#endif
+// Where opbdp_save_solution puts solutions - one per thread
+namespace {
+  struct OpbdpActive {
+    OpbdpSolutionStore * store;
+    PBCS * pbcs;
+  };
+}
+static OPBDP_THREAD_LOCAL OpbdpActive * opbdp_active=NULL;
+
+OpbdpSolutionStore::OpbdpSolutionStore()
+  : bits_(NULL),
+    numberSolutions_(0),
+    maximumSolutions_(0),
+    sizeSolution_(0)
+{
+}
+OpbdpSolutionStore::~OpbdpSolutionStore()
 {
-  if (opbdp_number_solutions==opbdp_maximum_solutions) {
-    opbdp_maximum_solutions = opbdp_maximum_solutions*2+100;
-    unsigned int ** temp = new unsigned int * [opbdp_maximum_solutions];
-    CoinMemcpyN(opbdp_solution,opbdp_number_solutions,temp);
-    CoinZeroN(temp+opbdp_number_solutions,opbdp_maximum_solutions-opbdp_number_solutions);
-    delete [] opbdp_solution;
-    opbdp_solution=temp;
+  delete [] bits_;
+}
+void
+OpbdpSolutionStore::reset(int numberColumns)
+{
+  int size = (numberColumns+31)/32;
+  if (size!=sizeSolution_) {
+    // keep same number of words
+    maximumSolutions_ = size ? (maximumSolutions_*sizeSolution_)/size : 0;
+    sizeSolution_ = size;
   }
-  unsigned int * array = new unsigned int [size_solution];
-  CoinZeroN(array,size_solution);
-  opbdp_solution[opbdp_number_solutions++]=array;
+  numberSolutions_=0;
+}
+unsigned int *
+OpbdpSolutionStore::addSolution()
+{
+  if (numberSolutions_==maximumSolutions_) {
+    maximumSolutions_ = maximumSolutions_*2+100;
+    unsigned int * temp = new unsigned int [maximumSolutions_*sizeSolution_];
+    CoinMemcpyN(bits_,numberSolutions_*sizeSolution_,temp);
+    delete [] bits_;
+    bits_=temp;
+  }
+  unsigned int * array = bits_+numberSolutions_*sizeSolution_;
+  CoinZeroN(array,sizeSolution_);
+  numberSolutions_++;
+  return array;
+}
+void opbdp_save_solution(OrdInt & sol)
+{
+  assert (opbdp_active);
+  unsigned int * array = opbdp_active->store->addSolution();
+  PBCS * pbcs = opbdp_active->pbcs;
   sol.first();
   while(!sol.last()) {
     int var = sol.next();
     if (var > 0)
       setAtOne(var-1,array,true);
   }
-  OrdInt Fixed = save_pbcs->get_fixed();
+  OrdInt Fixed = pbcs->get_fixed();
   Fixed.first();
   while(!Fixed.last()) {
     int flit = Fixed.next();
@@ -52,10 +89,10 @@ void opbdp_save_solution(OrdInt & sol)
       setAtOne(flit-1,array,true);
   }
   // add hidden ones due to equations
-  save_pbcs->Eq.first();
-  while(!save_pbcs->Eq.last()) {
-    int l = save_pbcs->Eq.next();
-    int r = save_pbcs->Eq(l);
+  pbcs->Eq.first();
+  while(!pbcs->Eq.last()) {
+    int l = pbcs->Eq.next();
+    int r = pbcs->Eq(l);
     if (sol.member(r) || Fixed.member(r)) 
       setAtOne(l-1,array,true);
     else if (sol.member(-r) || Fixed.member(-r))
@@ -96,7 +133,6 @@ static int gcd(int a, int b)
 static int solve(const OsiSolverInterface * model,PBCS & pbcs, OrdInt & sol)
 {
   int numberColumns = model->getNumCols();
-  size_solution = (numberColumns+31)/32;
   int numberRows = model->getNumRows();
   bool all01=true;
   int i;
@@ -236,7 +272,6 @@ static int solve(const OsiSolverInterface * model,PBCS & pbcs, OrdInt & sol)
 
   Products objf;
   Atoms atoms;  
-  save_pbcs = & pbcs;
   pbcs.set_atoms(&atoms);
   pbcs.set_enum_heuristic(0);
   for (i=0;i<numberColumns;i++) {
@@ -466,17 +501,49 @@ solveOpbdp(OsiSolverInterface * model)
 unsigned int ** 
 solveOpbdp(const OsiSolverInterface * model,int & numberFound)
 {
-  PBCS pbcs;
-  OrdInt sol;
-  pbcs.set_enum_verbosity(-1);
-  pbcs.set_verbosity(-1);
-  numberFound=solve(model,pbcs,sol);
-  if (numberFound>0||opbdp_number_solutions) {
+  OpbdpContext context;
+  numberFound=context.solveAll(model);
+  if (numberFound>0) {
     // all solutions
-    numberFound = opbdp_number_solutions;
-    return opbdp_solution;
+    const OpbdpSolutionStore & store = context.solutions();
+    int size = store.sizeSolution();
+    unsigned int ** solutions = new unsigned int * [numberFound];
+    for (int i=0;i<numberFound;i++)
+      solutions[i] = CoinCopyOfArray(store.solution(i),size);
+    return solutions;
   } else {
     // no solution
     return NULL;
   }
 }
+OpbdpContext::OpbdpContext()
+{
+}
+OpbdpContext::~OpbdpContext()
+{
+}
+int 
+OpbdpContext::solve(OsiSolverInterface * model)
+{
+  return solveOpbdp(model);
+}
+int 
+OpbdpContext::solveAll(const OsiSolverInterface * model)
+{
+  PBCS pbcs;
+  OrdInt sol;
+  pbcs.set_enum_verbosity(-1);
+  pbcs.set_verbosity(-1);
+  solutions_.reset(model->getNumCols());
+  OpbdpActive active;
+  active.store = &solutions_;
+  active.pbcs = &pbcs;
+  // allow for nesting
+  OpbdpActive * saveActive = opbdp_active;
+  opbdp_active = &active;
+  int numberFound=::solve(model,pbcs,sol);
+  opbdp_active = saveActive;
+  if (numberFound>0||solutions_.numberSolutions()) 
+    numberFound = solutions_.numberSolutions();
+  return numberFound;
+}
@@ -16,6 +16,8 @@ int solveOpbdp(OsiSolverInterface * model);
     Returns an array of bit solution vectors.
     i is 1 if bit set (see below) 
     If no solution then numberFound will be 0, if not suitable -1
+    Caller owns the returned arrays (delete [] each one then the array).
+    OpbdpContext avoids the allocation.
 
     This needs the line at about 206 of EnumerateOpt.cpp
 
@@ -34,6 +36,68 @@ int solveOpbdp(OsiSolverInterface * model);
  */
 unsigned int ** solveOpbdp(const OsiSolverInterface * model,int & numberFound);
 
+/** Bit packed store for 0-1 solutions.
+    All solutions are held in one block which is kept when the store is
+    reset so repeated enumerations reuse memory.
+ */
+class OpbdpSolutionStore {
+public:
+  OpbdpSolutionStore();
+  ~OpbdpSolutionStore();
+  /// Forget solutions (keeps memory) and set number of columns
+  void reset(int numberColumns);
+  /// Add a solution with all bits clear and return it
+  unsigned int * addSolution();
+  /// Number of solutions
+  inline int numberSolutions() const
+  { return numberSolutions_;}
+  /// Number of words in each solution
+  inline int sizeSolution() const
+  { return sizeSolution_;}
+  /// Solution i (use atOne to look at bits)
+  inline const unsigned int * solution(int i) const
+  { return bits_+i*sizeSolution_;}
+private:
+  /// Illegal
+  OpbdpSolutionStore(const OpbdpSolutionStore &);
+  OpbdpSolutionStore & operator=(const OpbdpSolutionStore &);
+  /// Solutions
+  unsigned int * bits_;
+  /// Number of solutions
+  int numberSolutions_;
+  /// Number of solutions there is room for
+  int maximumSolutions_;
+  /// Number of words in each solution
+  int sizeSolution_;
+};
+
+/** Context for opbdp enumeration.
+    Each context owns its solutions so several contexts can be used at
+    once, one per thread.  The solution hook in EnumerateOpt.cpp (see
+    above) saves into whichever context is solving on the calling thread.
+ */
+class OpbdpContext {
+public:
+  OpbdpContext();
+  ~OpbdpContext();
+  /** Solve for best solution - as solveOpbdp(model) */
+  int solve(OsiSolverInterface * model);
+  /** Find all solutions.
+      Returns number found or -1 if not suitable.  Solutions are
+      valid until next call.
+  */
+  int solveAll(const OsiSolverInterface * model);
+  /// Solutions from last solveAll
+  inline const OpbdpSolutionStore & solutions() const
+  { return solutions_;}
+private:
+  /// Illegal
+  OpbdpContext(const OpbdpContext &);
+  OpbdpContext & operator=(const OpbdpContext &);
+  /// Solutions
+  OpbdpSolutionStore solutions_;
+};
+
 inline bool atOne(int i,unsigned int * array) {
   return ((array[i>>5]>>(i&31))&1)!=0;
 }
@@ -9,9 +9,15 @@
 
 #include "CoinPragma.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinFinite.hpp"
 #include "OsiSolverInterface.hpp"
+#include "OsiBranchingObject.hpp"
 #include "OsiAuxInfo.hpp"
 
+#if OSI_HAS_THREADS
+#include <atomic>
+#endif
+
 // Default Constructor
 OsiAuxInfo::OsiAuxInfo(void *appData)
   : appData_(appData)
@@ -43,6 +49,205 @@ OsiAuxInfo::operator=(const OsiAuxInfo &rhs)
   }
   return *this;
 }
+namespace {
+// A published solution - never changed once current points to it
+struct OsiIncumbentSnapshot {
+  // Objective value (minimization)
+  double objectiveValue;
+  // Number of columns
+  int numberColumns;
+  // Solution values
+  double *solution;
+  // Next retired snapshot
+  OsiIncumbentSnapshot *next;
+};
+
+// Frees list
+void freeSnapshots(OsiIncumbentSnapshot *snapshot)
+{
+  while (snapshot) {
+    OsiIncumbentSnapshot *next = snapshot->next;
+    delete[] snapshot->solution;
+    delete snapshot;
+    snapshot = next;
+  }
+}
+} // end file-local namespace
+
+#if OSI_HAS_THREADS
+/*
+  Retired snapshots are pushed on a lock free list. reclaim() first takes
+  the whole list and only then looks at the count of readers; every
+  snapshot it took was replaced before that, so if there are no readers
+  nobody can still be copying from it (a reader counts itself in before
+  it loads current). Otherwise the list goes back for a later try.
+*/
+struct OsiIncumbent::Store {
+  Store()
+    : objectiveValue(COIN_DBL_MAX)
+    , current(NULL)
+    , retired(NULL)
+    , readers(0)
+  {
+  }
+  // Adds the list first ... last to the retired snapshots
+  void retire(OsiIncumbentSnapshot *first, OsiIncumbentSnapshot *last)
+  {
+    OsiIncumbentSnapshot *head = retired.load();
+    do {
+      last->next = head;
+    } while (!retired.compare_exchange_weak(head, first));
+  }
+  // Frees the retired snapshots if nobody is reading
+  void reclaim()
+  {
+    OsiIncumbentSnapshot *list = retired.exchange(NULL);
+    if (!list)
+      return;
+    if (!readers.load()) {
+      freeSnapshots(list);
+    } else {
+      OsiIncumbentSnapshot *last = list;
+      while (last->next)
+        last = last->next;
+      retire(list, last);
+    }
+  }
+  // Objective value of current snapshot
+  std::atomic< double > objectiveValue;
+  // Current snapshot
+  std::atomic< OsiIncumbentSnapshot * > current;
+  // Replaced snapshots not yet freed
+  std::atomic< OsiIncumbentSnapshot * > retired;
+  // Number of calls reading a snapshot
+  std::atomic< int > readers;
+};
+#else
+struct OsiIncumbent::Store {
+  Store()
+    : objectiveValue(COIN_DBL_MAX)
+    , current(NULL)
+  {
+  }
+  // Objective value of current snapshot
+  double objectiveValue;
+  // Current snapshot
+  OsiIncumbentSnapshot *current;
+};
+#endif
+
+// Default Constructor
+OsiIncumbent::OsiIncumbent()
+  : store_(new Store)
+{
+}
+
+// Destructor
+OsiIncumbent::~OsiIncumbent()
+{
+  clear();
+  delete store_;
+}
+
+// Objective value of the incumbent
+double
+OsiIncumbent::objectiveValue() const
+{
+#if OSI_HAS_THREADS
+  return store_->objectiveValue.load(std::memory_order_acquire);
+#else
+  return store_->objectiveValue;
+#endif
+}
+
+// Returns true if solution is now the incumbent
+bool OsiIncumbent::offer(const double *solution, int numberColumns,
+  double objectiveValue)
+{
+  // cheap test before copying
+  if (objectiveValue >= this->objectiveValue())
+    return false;
+  OsiIncumbentSnapshot *snapshot = new OsiIncumbentSnapshot;
+  snapshot->objectiveValue = objectiveValue;
+  snapshot->numberColumns = numberColumns;
+  snapshot->solution = CoinCopyOfArray(solution, numberColumns);
+  snapshot->next = NULL;
+#if OSI_HAS_THREADS
+  // reads the value of current
+  store_->readers.fetch_add(1);
+  OsiIncumbentSnapshot *current = store_->current.load();
+  do {
+    if (current && current->objectiveValue <= objectiveValue) {
+      // someone else was quicker
+      store_->readers.fetch_sub(1);
+      freeSnapshots(snapshot);
+      return false;
+    }
+  } while (!store_->current.compare_exchange_weak(current, snapshot));
+  store_->readers.fetch_sub(1);
+  // value is only ever lowered so it ends up as that of current
+  double published = store_->objectiveValue.load(std::memory_order_relaxed);
+  while (objectiveValue < published
+    && !store_->objectiveValue.compare_exchange_weak(published, objectiveValue,
+      std::memory_order_release, std::memory_order_relaxed)) {
+  }
+  if (current)
+    store_->retire(current, current);
+  store_->reclaim();
+#else
+  freeSnapshots(store_->current);
+  store_->current = snapshot;
+  store_->objectiveValue = objectiveValue;
+#endif
+  return true;
+}
+
+// Returns true if incumbent better than objectiveValue
+bool OsiIncumbent::solution(double &objectiveValue, double *solution,
+  int numberColumns) const
+{
+#if OSI_HAS_THREADS
+  store_->readers.fetch_add(1);
+  const OsiIncumbentSnapshot *current = store_->current.load();
+#else
+  const OsiIncumbentSnapshot *current = store_->current;
+#endif
+  bool better = current && current->objectiveValue < objectiveValue;
+  if (better) {
+    int n = CoinMin(numberColumns, current->numberColumns);
+    CoinMemcpyN(current->solution, n, solution);
+    if (n < numberColumns)
+      CoinZeroN(solution + n, numberColumns - n);
+    objectiveValue = current->objectiveValue;
+  }
+#if OSI_HAS_THREADS
+  store_->readers.fetch_sub(1);
+#endif
+  return better;
+}
+
+// Lowers cutoff
+void OsiIncumbent::updateCutoff(OsiBranchingInformation &info) const
+{
+  double value = objectiveValue();
+  if (value < info.cutoff_)
+    info.cutoff_ = value;
+}
+
+// Drops incumbent
+void OsiIncumbent::clear()
+{
+#if OSI_HAS_THREADS
+  freeSnapshots(store_->current.exchange(NULL));
+  freeSnapshots(store_->retired.exchange(NULL));
+  store_->objectiveValue.store(COIN_DBL_MAX);
+#else
+  freeSnapshots(store_->current);
+  store_->current = NULL;
+  store_->objectiveValue = COIN_DBL_MAX;
+#endif
+}
+
 // Default Constructor
 OsiBabSolver::OsiBabSolver(int solverType)
   : OsiAuxInfo()
@@ -53,6 +258,7 @@ OsiBabSolver::OsiBabSolver(int solverType)
   , beforeLower_(NULL)
   , beforeUpper_(NULL)
   , extraInfo_(NULL)
+  , incumbent_(NULL)
   , solverType_(solverType)
   , sizeSolution_(0)
   , extraCharacteristics_(0)
@@ -82,6 +288,7 @@ OsiBabSolver::OsiBabSolver(const OsiBabSolver &rhs)
   , beforeLower_(rhs.beforeLower_)
   , beforeUpper_(rhs.beforeUpper_)
   , extraInfo_(rhs.extraInfo_)
+  , incumbent_(rhs.incumbent_)
   , solverType_(rhs.solverType_)
   , sizeSolution_(rhs.sizeSolution_)
   , extraCharacteristics_(rhs.extraCharacteristics_)
@@ -107,6 +314,7 @@ OsiBabSolver::operator=(const OsiBabSolver &rhs)
     beforeLower_ = rhs.beforeLower_;
     beforeUpper_ = rhs.beforeUpper_;
     extraInfo_ = rhs.extraInfo_;
+    incumbent_ = rhs.incumbent_;
     if (rhs.bestSolution_) {
       assert(solver_);
       bestSolution_ = CoinCopyOfArray(rhs.bestSolution_, sizeSolution_);
@@ -133,7 +341,12 @@ int OsiBabSolver::solution(double &solutionValue,
     //delete [] bestSolution_;
     //bestSolution_=NULL;
     //bestObjectiveValue_=1.0e100;
+    if (incumbent_)
+      incumbent_->solution(solutionValue, betterSolution, numberColumns);
     return 1;
+  } else if (incumbent_) {
+    // shared solution may be better
+    return incumbent_->solution(solutionValue, betterSolution, numberColumns) ? 1 : 0;
   } else {
     return 0;
   }
@@ -150,6 +363,14 @@ bool OsiBabSolver::hasSolution(double &solutionValue, double *solution)
   return true;
 }
 
+bool OsiBabSolver::sharedSolution(double &solutionValue, double *solution) const
+{
+  if (!incumbent_ || !solver_)
+    return false;
+  solutionValue = COIN_DBL_MAX;
+  return incumbent_->solution(solutionValue, solution, solver_->getNumCols());
+}
+
 // set solution
 void OsiBabSolver::setSolution(const double *solution, int numberColumns, double objectiveValue)
 {
@@ -161,6 +382,8 @@ void OsiBabSolver::setSolution(const double *solution, int numberColumns, double
   CoinZeroN(bestSolution_, sizeSolution_);
   CoinMemcpyN(solution, CoinMin(sizeSolution_, numberColumns), bestSolution_);
   bestObjectiveValue_ = objectiveValue * solver_->getObjSense();
+  if (incumbent_)
+    incumbent_->offer(bestSolution_, sizeSolution_, bestObjectiveValue_);
 }
 // Get objective  (well mip bound)
 double
@@ -8,6 +8,7 @@
 #include "OsiConfig.h"
 
 class OsiSolverInterface;
+class OsiBranchingInformation;
 
 //#############################################################################
 /** This class allows for a more structured use of algorithmic tweaking to
@@ -45,6 +46,58 @@ protected:
   /// Pointer to user-defined data structure
   void *appData_;
 };
+//#############################################################################
+/** Incumbent (best integer solution) which can be shared between threads.
+
+    The objective value (minimization sense) is published atomically, so
+    workers can read it (say to refresh OsiBranchingInformation::cutoff_)
+    without taking a lock. A better solution is copied once into a new
+    snapshot which is then swapped in by pointer; readers copy from the
+    snapshot they loaded. A replaced snapshot is retired and freed by a
+    later offer() once no call is reading any snapshot (a count of readers
+    is kept), so memory stays bounded as long as the readers are not
+    continuous. clear() and the destructor free everything and must not
+    run concurrently with other calls.
+
+    The atomics are only used when built with OSI_HAS_THREADS (see
+    OsiConfig.h); otherwise this is a plain single threaded store. They
+    are kept in OsiAuxInfo.cpp so the layout of the class is the same
+    either way.
+*/
+
+class OSILIB_EXPORT OsiIncumbent {
+public:
+  /// Default Constructor
+  OsiIncumbent();
+  /// Destructor
+  ~OsiIncumbent();
+
+  /// Objective value of the incumbent (minimization), COIN_DBL_MAX if none
+  double objectiveValue() const;
+  /** Offers a solution with objective value (minimization) objectiveValue.
+      Returns true if it was better than the incumbent and is now published. */
+  bool offer(const double *solution, int numberColumns, double objectiveValue);
+  /** Copies the incumbent into solution (numberColumns long, padded with
+      zeros) and sets objectiveValue if there is an incumbent better than
+      objectiveValue. Returns true if it did. */
+  bool solution(double &objectiveValue, double *solution, int numberColumns) const;
+  /// Lowers info.cutoff_ to the incumbent value if that is better
+  void updateCutoff(OsiBranchingInformation &info) const;
+  /// Drops the incumbent and frees all snapshots (not thread safe)
+  void clear();
+
+private:
+  /// Not copyable
+  OsiIncumbent(const OsiIncumbent &);
+  /// Not assignable
+  OsiIncumbent &operator=(const OsiIncumbent &);
+
+  /// Published value and snapshots (see OsiAuxInfo.cpp)
+  struct Store;
+  /// Owned store
+  Store *store_;
+};
+
 //#############################################################################
 /** This class allows for the use of more exotic solvers e.g. Non-Linear or Volume.
 
@@ -89,12 +142,31 @@ public:
       Size of solution is numberColumns (may be padded or truncated in function) */
   void setSolution(const double *solution, int numberColumns, double objectiveValue);
 
+  /** Share an incumbent (not owned, kept by copies) with other solvers.
+      setSolution then also offers to it and solution also looks at it.
+      hasSolution and bestObjectiveValue only look at this object's own
+      solution; sharedSolution gives the shared one. */
+  inline void setIncumbent(OsiIncumbent *incumbent)
+  {
+    incumbent_ = incumbent;
+  }
+  /// Shared incumbent (NULL if none)
+  inline OsiIncumbent *incumbent() const
+  {
+    return incumbent_;
+  }
+
   /** returns true if the object stores a solution, false otherwise. If there
 	  is a solution then solutionValue and solution will be filled out as well.
       In that case the user needs to allocate solution to be a big enough
 	  array.
   */
   bool hasSolution(double &solutionValue, double *solution);
+  /** returns true if there is a shared incumbent with a solution. If so
+      solutionValue (minimization) and solution are filled out from it;
+      solution must be as long as the number of columns of the solver.
+  */
+  bool sharedSolution(double &solutionValue, double *solution) const;
 
   /** Sets solver type
       0 - normal LP solver
@@ -234,6 +306,8 @@ protected:
   const double *beforeUpper_;
   /// Pointer to extra info
   void *extraInfo_;
+  /// Shared incumbent (not owned)
+  OsiIncumbent *incumbent_;
   /** Solver type
       0 - normal LP solver
       1 - DW - may also return heuristic solutions
@@ -0,0 +1,502 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "OsiConfig.h"
+
+#include <algorithm>
+#include <vector>
+#if OSI_HAS_THREADS
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinFinite.hpp"
+#include "CoinWarmStart.hpp"
+
+#include "OsiSolverInterface.hpp"
+#include "OsiSolverBranch.hpp"
+#include "OsiAuxInfo.hpp"
+#include "OsiBranchingObject.hpp"
+#include "OsiChooseVariable.hpp"
+#include "OsiBranchAndBound.hpp"
+
+#if OSI_HAS_THREADS
+typedef std::unique_lock< std::mutex > OsiBabLock;
+#endif
+
+namespace {
+
+//#############################################################################
+// Open nodes and the state shared by the workers
+//#############################################################################
+
+/*
+  An open node. The bounds are those tightened with respect to the root (as
+  the first way of an OsiSolverBranch), the basis is a diff from the root
+  basis (NULL if the solver can not do diffs). The objective value is that
+  of the parent (in minimization sense), a lower bound for the node.
+*/
+struct OsiBabNode {
+  double objectiveValue;
+  int depth;
+  OsiSolverBranch bounds;
+  CoinWarmStartDiff *basisDiff;
+
+  OsiBabNode(double value, int nodeDepth)
+    : objectiveValue(value)
+    , depth(nodeDepth)
+    , basisDiff(NULL)
+  {
+  }
+  ~OsiBabNode() { delete basisDiff; }
+};
+
+// Orders the node heap so that the node with the best bound is on top
+struct OsiBabNodeWorse {
+  bool operator()(const OsiBabNode *a, const OsiBabNode *b) const
+  {
+    return a->objectiveValue > b->objectiveValue;
+  }
+};
+
+/*
+  Everything the workers share. The root data is only read during the
+  search, the incumbent is lock free and the rest is guarded by mutex.
+*/
+struct OsiBabSearch {
+  const CoinWarmStart *rootBasis;
+  const double *rootLower;
+  const double *rootUpper;
+  int numberColumns;
+  int diveLimit;
+  int maximumNodes;
+
+  // heap of open nodes (see OsiBabNodeWorse)
+  std::vector< OsiBabNode * > heap;
+  // workers holding a node
+  int numberBusy;
+  int numberNodes;
+  bool stopped;
+  // cutoff given by the user (minimization sense)
+  double cutoff;
+  // best solution
+  OsiIncumbent incumbent;
+#if OSI_HAS_THREADS
+  std::mutex mutex;
+  std::condition_variable wakeUp;
+#endif
+};
+
+// Best objective value so far (minimization sense)
+inline double currentCutoff(const OsiBabSearch &search)
+{
+  return CoinMin(search.cutoff, search.incumbent.objectiveValue());
+}
+
+// Counts a node; returns false (and stops the search) at the node limit
+bool countNode(OsiBabSearch &search)
+{
+#if OSI_HAS_THREADS
+  OsiBabLock lock(search.mutex);
+#endif
+  if (search.stopped)
+    return false;
+  if (search.numberNodes >= search.maximumNodes) {
+    search.stopped = true;
+#if OSI_HAS_THREADS
+    search.wakeUp.notify_all();
+#endif
+    return false;
+  }
+  search.numberNodes++;
+  return true;
+}
+
+// Offers an integer solution
+inline void newSolution(OsiBabSearch &search, double value, const double *solution)
+{
+  if (value < search.cutoff)
+    search.incumbent.offer(solution, search.numberColumns, value);
+}
+
+// Puts nodes on the heap
+void pushNodes(OsiBabSearch &search, OsiBabNode **nodes, int number)
+{
+  if (!number)
+    return;
+#if OSI_HAS_THREADS
+  OsiBabLock lock(search.mutex);
+#endif
+  for (int i = 0; i < number; i++) {
+    search.heap.push_back(nodes[i]);
+    std::push_heap(search.heap.begin(), search.heap.end(), OsiBabNodeWorse());
+  }
+#if OSI_HAS_THREADS
+  search.wakeUp.notify_all();
+#endif
+}
+
+/*
+  Hands out the open node with the best bound, skipping nodes which can
+  not beat the incumbent. If the caller was working on a node it says so
+  with wasBusy. Returns NULL when the search is over: the heap is empty and
+  no worker can add to it, or the search was stopped.
+*/
+OsiBabNode *takeNode(OsiBabSearch &search, bool wasBusy)
+{
+#if OSI_HAS_THREADS
+  OsiBabLock lock(search.mutex);
+#endif
+  if (wasBusy)
+    search.numberBusy--;
+  while (true) {
+    while (!search.stopped && !search.heap.empty()) {
+      std::pop_heap(search.heap.begin(), search.heap.end(), OsiBabNodeWorse());
+      OsiBabNode *node = search.heap.back();
+      search.heap.pop_back();
+      if (node->objectiveValue < currentCutoff(search)) {
+        search.numberBusy++;
+        return node;
+      }
+      delete node;
+    }
+    if (search.stopped || !search.numberBusy)
+      break;
+#if OSI_HAS_THREADS
+    search.wakeUp.wait(lock);
+#else
+    break;
+#endif
+  }
+#if OSI_HAS_THREADS
+  search.wakeUp.notify_all();
+#endif
+  return NULL;
+}
+
+// Sets the column bounds of solver back to lower/upper where they differ
+void restoreBounds(OsiSolverInterface *solver, const double *lower,
+  const double *upper, int numberColumns)
+{
+  const double *columnLower = solver->getColLower();
+  const double *columnUpper = solver->getColUpper();
+  for (int i = 0; i < numberColumns; i++) {
+    if (columnLower[i] != lower[i])
+      solver->setColLower(i, lower[i]);
+    if (columnUpper[i] != upper[i])
+      solver->setColUpper(i, upper[i]);
+  }
+}
+
+//#############################################################################
+// The worker
+//#############################################################################
+
+/*
+  Solves a node and creates its children (preferred child first). Returns
+  the number of children; 0 if the node was pruned, infeasible or gave an
+  integer solution.
+*/
+int processNode(OsiBabSearch &search, OsiSolverInterface *solver,
+  OsiChooseVariable *chooser, const OsiBabNode &node,
+  double *parentLower, double *parentUpper,
+  std::vector< OsiBabNode * > &children)
+{
+  OSI_TRACE_SCOPE("node");
+  const int numberColumns = search.numberColumns;
+  children.clear();
+
+  // bounds of the node: back to the root, then tighten
+  restoreBounds(solver, search.rootLower, search.rootUpper, numberColumns);
+  node.bounds.applyBounds(*solver, -1);
+  if (node.basisDiff)
+    solver->setWarmStartDiff(search.rootBasis, node.basisDiff);
+
+  OsiBranchingObject *branch = NULL;
+  double objectiveValue = 0.0;
+  while (!branch) {
+    solver->resolve();
+    if (!solver->isProvenOptimal())
+      return 0;
+    objectiveValue = solver->getObjValue() * solver->getObjSense();
+    if (objectiveValue >= currentCutoff(search))
+      return 0;
+
+    OsiBranchingInformation info(solver, true, false);
+    info.cutoff_ = search.cutoff;
+    search.incumbent.updateCutoff(info);
+    info.depth_ = node.depth;
+    int numberUnsatisfied = chooser->setupList(&info, true);
+    if (numberUnsatisfied < 0)
+      return 0;
+    if (!numberUnsatisfied) {
+      newSolution(search, objectiveValue, solver->getColSolution());
+      return 0;
+    }
+    int returnCode = chooser->chooseVariable(solver, &info, true);
+    if (chooser->goodSolution()) {
+      // strong branching came across an integer solution
+      newSolution(search, chooser->goodObjectiveValue(), chooser->goodSolution());
+      chooser->clearGoodSolution();
+    }
+    if (returnCode < 0)
+      return 0;
+    if (returnCode == 1) {
+      newSolution(search, objectiveValue, solver->getColSolution());
+      return 0;
+    }
+    if (returnCode == 0) {
+      const OsiObject *object = solver->object(chooser->bestObjectIndex());
+      branch = object->createBranch(solver, &info, chooser->bestWhichWay());
+    }
+    // otherwise bounds were changed - solve again
+  }
+
+  // basis of the children
+  CoinWarmStartDiff *basisDiff = solver->getWarmStartDiff(search.rootBasis);
+
+  CoinMemcpyN(solver->getColLower(), numberColumns, parentLower);
+  CoinMemcpyN(solver->getColUpper(), numberColumns, parentUpper);
+  const int numberBranches = branch->numberBranches();
+  for (int i = 0; i < numberBranches; i++) {
+    branch->branch(solver);
+    OsiBabNode *child = new OsiBabNode(objectiveValue, node.depth + 1);
+    child->bounds.addBranch(-1, numberColumns, search.rootLower,
+      solver->getColLower(), search.rootUpper, solver->getColUpper());
+    if (basisDiff)
+      child->basisDiff = basisDiff->clone();
+    children.push_back(child);
+    restoreBounds(solver, parentLower, parentUpper, numberColumns);
+  }
+  delete basisDiff;
+  delete branch;
+  return numberBranches;
+}
+
+/*
+  Runs a worker on its own solver and chooser (made by the caller before
+  any worker starts, as cloning and evaluating objects is not thread safe).
+*/
+void runWorker(OsiBabSearch *search, OsiSolverInterface *solver,
+  OsiChooseVariable *chooser)
+{
+  double *parentLower = new double[search->numberColumns];
+  double *parentUpper = new double[search->numberColumns];
+  std::vector< OsiBabNode * > children;
+
+  OsiBabNode *node = takeNode(*search, false);
+  int numberDived = 0;
+  while (node) {
+    if (!countNode(*search)) {
+      // node limit - keep the node for the bound
+      pushNodes(*search, &node, 1);
+      node = takeNode(*search, true);
+      continue;
+    }
+    int numberChildren = processNode(*search, solver, chooser, *node,
+      parentLower, parentUpper, children);
+    delete node;
+    node = NULL;
+    if (numberChildren && numberDived < search->diveLimit) {
+      // go on with the preferred child
+      node = children[0];
+      pushNodes(*search, &children[0] + 1, numberChildren - 1);
+      numberDived++;
+    } else {
+      pushNodes(*search, numberChildren ? &children[0] : NULL, numberChildren);
+      node = takeNode(*search, true);
+      numberDived = 0;
+    }
+  }
+
+  delete[] parentLower;
+  delete[] parentUpper;
+}
+
+} // namespace
+
+//#############################################################################
+// Search
+//#############################################################################
+
+void OsiBranchAndBound::setChooser(const OsiChooseVariable &chooser)
+{
+  delete chooser_;
+  chooser_ = chooser.clone();
+}
+
+int OsiBranchAndBound::solve(OsiSolverInterface *solver)
+{
+  delete[] bestSolution_;
+  bestSolution_ = NULL;
+  numberNodes_ = 0;
+  const double direction = solver->getObjSense();
+  bestObjective_ = direction * COIN_DBL_MAX;
+  bestPossible_ = direction * COIN_DBL_MAX;
+
+  if (!solver->numberObjects())
+    solver->findIntegers(false);
+  solver->initialSolve();
+  if (!solver->isProvenOptimal())
+    return -1;
+
+  numberColumns_ = solver->getNumCols();
+  double *rootLower = CoinCopyOfArray(solver->getColLower(), numberColumns_);
+  double *rootUpper = CoinCopyOfArray(solver->getColUpper(), numberColumns_);
+  CoinWarmStart *rootBasis = solver->getWarmStart();
+  OsiChooseVariable *chooser = chooser_ ? chooser_ : new OsiChooseVariable(solver);
+
+  OsiBabSearch search;
+  search.rootBasis = rootBasis;
+  search.rootLower = rootLower;
+  search.rootUpper = rootUpper;
+  search.numberColumns = numberColumns_;
+  search.diveLimit = diveLimit_;
+  search.maximumNodes = maximumNodes_;
+  search.numberBusy = 0;
+  search.numberNodes = 0;
+  search.stopped = false;
+  search.cutoff = cutoff_ * direction;
+  search.heap.push_back(new OsiBabNode(solver->getObjValue() * direction, 0));
+
+#if OSI_HAS_THREADS
+  const int numberWorkers = numberThreads_;
+#else
+  const int numberWorkers = 1;
+#endif
+  /*
+    Clones are made here, one after the other; each has objects of its own
+    as evaluating objects changes them.
+  */
+  std::vector< OsiSolverInterface * > workerSolvers(numberWorkers);
+  std::vector< OsiChooseVariable * > workerChoosers(numberWorkers);
+  for (int i = 0; i < numberWorkers; i++) {
+    workerSolvers[i] = solver->clone();
+    workerChoosers[i] = chooser->clone();
+    workerChoosers[i]->setSolver(workerSolvers[i]);
+  }
+#if OSI_HAS_THREADS
+  if (numberWorkers > 1) {
+    std::vector< std::thread > workers;
+    for (int i = 0; i < numberWorkers; i++)
+      workers.push_back(std::thread(runWorker, &search, workerSolvers[i],
+        workerChoosers[i]));
+    for (int i = 0; i < numberWorkers; i++)
+      workers[i].join();
+  } else {
+    runWorker(&search, workerSolvers[0], workerChoosers[0]);
+  }
+#else
+  runWorker(&search, workerSolvers[0], workerChoosers[0]);
+#endif
+  for (int i = 0; i < numberWorkers; i++) {
+    delete workerChoosers[i];
+    delete workerSolvers[i];
+  }
+
+  // bound from the nodes left
+  double bestPossible = currentCutoff(search);
+  for (size_t i = 0; i < search.heap.size(); i++) {
+    bestPossible = CoinMin(bestPossible, search.heap[i]->objectiveValue);
+    delete search.heap[i];
+  }
+  numberNodes_ = search.numberNodes;
+  bestSolution_ = new double[numberColumns_];
+  double bestObjective = COIN_DBL_MAX;
+  if (search.incumbent.solution(bestObjective, bestSolution_, numberColumns_)) {
+    bestObjective_ = bestObjective * direction;
+  } else {
+    delete[] bestSolution_;
+    bestSolution_ = NULL;
+  }
+  if (bestSolution_ || search.stopped)
+    bestPossible_ = bestPossible * direction;
+
+  if (chooser != chooser_)
+    delete chooser;
+  delete rootBasis;
+  delete[] rootLower;
+  delete[] rootUpper;
+  return search.stopped ? 1 : 0;
+}
+
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiBranchAndBound::OsiBranchAndBound()
+  : chooser_(NULL)
+  , numberThreads_(1)
+  , diveLimit_(20)
+  , maximumNodes_(COIN_INT_MAX)
+  , cutoff_(COIN_DBL_MAX)
+  , numberColumns_(0)
+  , bestSolution_(NULL)
+  , bestObjective_(COIN_DBL_MAX)
+  , bestPossible_(COIN_DBL_MAX)
+  , numberNodes_(0)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+OsiBranchAndBound::OsiBranchAndBound(const OsiBranchAndBound &rhs)
+  : chooser_(rhs.chooser_ ? rhs.chooser_->clone() : NULL)
+  , numberThreads_(rhs.numberThreads_)
+  , diveLimit_(rhs.diveLimit_)
+  , maximumNodes_(rhs.maximumNodes_)
+  , cutoff_(rhs.cutoff_)
+  , numberColumns_(rhs.numberColumns_)
+  , bestSolution_(CoinCopyOfArray(rhs.bestSolution_, rhs.numberColumns_))
+  , bestObjective_(rhs.bestObjective_)
+  , bestPossible_(rhs.bestPossible_)
+  , numberNodes_(rhs.numberNodes_)
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+OsiBranchAndBound::~OsiBranchAndBound()
+{
+  delete chooser_;
+  delete[] bestSolution_;
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+OsiBranchAndBound &
+OsiBranchAndBound::operator=(const OsiBranchAndBound &rhs)
+{
+  if (this != &rhs) {
+    delete chooser_;
+    delete[] bestSolution_;
+    chooser_ = rhs.chooser_ ? rhs.chooser_->clone() : NULL;
+    numberThreads_ = rhs.numberThreads_;
+    diveLimit_ = rhs.diveLimit_;
+    maximumNodes_ = rhs.maximumNodes_;
+    cutoff_ = rhs.cutoff_;
+    numberColumns_ = rhs.numberColumns_;
+    bestSolution_ = CoinCopyOfArray(rhs.bestSolution_, rhs.numberColumns_);
+    bestObjective_ = rhs.bestObjective_;
+    bestPossible_ = rhs.bestPossible_;
+    numberNodes_ = rhs.numberNodes_;
+  }
+  return *this;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,182 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiBranchAndBound_H
+#define OsiBranchAndBound_H
+
+#include "OsiConfig.h"
+
+class OsiSolverInterface;
+class OsiChooseVariable;
+
+//#############################################################################
+
+/** Reference branch and bound driver
+
+    A solver agnostic branch and bound built from the Osi pieces: the objects
+    of the solver (simple integers unless the solver already has objects),
+    an OsiChooseVariable (or OsiChooseStrong, ...) to pick the branching
+    object and OsiBranchingObject to create the children.  It gives any LP
+    solver interface a working MIP search; it is not meant to compete with
+    a real MIP solver (no cuts, no heuristics beyond strong branching).
+
+    Open nodes are stored compactly: the column bounds tightened with
+    respect to the root as an OsiSolverBranch and the basis as a diff from
+    the root basis (see OsiSolverInterface::getWarmStartDiff).
+
+    The search is best first with dives: a worker goes on with the preferred
+    child of the node it just branched on for up to #diveLimit() nodes and
+    puts the other children on the queue; then it takes the node with the
+    best bound from the queue.
+
+    With OSI_HAS_THREADS (see OsiConfig.h) the nodes are processed by
+    #numberThreads() workers, each owning a clone of the solver and of the
+    chooser; otherwise a single worker runs in the calling thread.
+*/
+
+class OSILIB_EXPORT OsiBranchAndBound {
+
+public:
+  ///@name Parameters
+  //@{
+  /** Set the chooser used to pick the branching object (a clone is kept).
+      The default is an OsiChooseVariable. */
+  void setChooser(const OsiChooseVariable &chooser);
+  /// Chooser used to pick the branching object
+  inline const OsiChooseVariable *chooser() const
+  {
+    return chooser_;
+  }
+  /// Set number of worker threads (1 unless built with OSI_HAS_THREADS)
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value > 0 ? value : 1;
+  }
+  /// Number of worker threads
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Set number of nodes a worker dives before going back to the queue
+  inline void setDiveLimit(int value)
+  {
+    diveLimit_ = value;
+  }
+  /// Number of nodes a worker dives before going back to the queue
+  inline int diveLimit() const
+  {
+    return diveLimit_;
+  }
+  /// Set maximum number of nodes to process
+  inline void setMaximumNodes(int value)
+  {
+    maximumNodes_ = value;
+  }
+  /// Maximum number of nodes to process
+  inline int maximumNodes() const
+  {
+    return maximumNodes_;
+  }
+  /** Set objective cutoff (in the objective sense of the solver); nodes
+      which can not beat it are pruned */
+  inline void setCutoff(double value)
+  {
+    cutoff_ = value;
+  }
+  /// Objective cutoff (in the objective sense of the solver)
+  inline double cutoff() const
+  {
+    return cutoff_;
+  }
+  //@}
+
+  ///@name Search
+  //@{
+  /** Run branch and bound on the problem held by \p solver.
+
+      The root is solved with initialSolve() on \p solver, which is left as
+      it is after the root solve; the search works on clones.  If the
+      solver has no objects, simple integers are created first.
+
+      Returns 0 if the search finished (the best solution, if any, is
+      optimal), 1 if it stopped on the node limit and -1 if the root
+      relaxation could not be solved to optimality (say infeasible).
+  */
+  int solve(OsiSolverInterface *solver);
+  //@}
+
+  ///@name Results
+  //@{
+  /// Whether an integer solution was found
+  inline bool hasSolution() const
+  {
+    return bestSolution_ != NULL;
+  }
+  /// Best integer solution found (NULL if none)
+  inline const double *bestSolution() const
+  {
+    return bestSolution_;
+  }
+  /// Objective value of the best solution (in the objective sense of the solver)
+  inline double bestObjective() const
+  {
+    return bestObjective_;
+  }
+  /// Best possible objective value (equals bestObjective() after a complete search)
+  inline double bestPossible() const
+  {
+    return bestPossible_;
+  }
+  /// Number of nodes processed
+  inline int numberNodes() const
+  {
+    return numberNodes_;
+  }
+  //@}
+
+  ///@name Constructors and destructors
+  //@{
+  /// Default Constructor
+  OsiBranchAndBound();
+
+  /// Copy constructor (parameters and results)
+  OsiBranchAndBound(const OsiBranchAndBound &rhs);
+
+  /// Assignment operator
+  OsiBranchAndBound &operator=(const OsiBranchAndBound &rhs);
+
+  /// Destructor
+  ~OsiBranchAndBound();
+  //@}
+
+private:
+  ///@name Private member data
+  //@{
+  /// Chooser (cloned for each worker)
+  OsiChooseVariable *chooser_;
+  /// Number of worker threads
+  int numberThreads_;
+  /// Number of nodes a worker dives
+  int diveLimit_;
+  /// Maximum number of nodes
+  int maximumNodes_;
+  /// Objective cutoff
+  double cutoff_;
+  /// Number of columns (size of bestSolution_)
+  int numberColumns_;
+  /// Best solution
+  double *bestSolution_;
+  /// Objective value of best solution
+  double bestObjective_;
+  /// Best possible objective value
+  double bestPossible_;
+  /// Number of nodes processed
+  int numberNodes_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
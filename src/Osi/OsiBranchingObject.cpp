@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <algorithm>
 //#define OSI_DEBUG
 #include "OsiSolverInterface.hpp"
 #include "OsiBranchingObject.hpp"
@@ -19,6 +20,19 @@
 #include "CoinError.hpp"
 #include "CoinFinite.hpp"
 
+#if OSI_HAS_THREADS
+#include <atomic>
+#endif
+
+namespace {
+// Calls of OsiObject::setPriority
+#if OSI_HAS_THREADS
+std::atomic< unsigned int > priorityChanges(0);
+#else
+unsigned int priorityChanges = 0;
+#endif
+}
+
 // Default Constructor
 OsiObject::OsiObject()
   : infeasibility_(0.0)
@@ -33,6 +47,19 @@ OsiObject::~OsiObject()
 {
 }
 
+// Set priority
+void OsiObject::setPriority(int priority)
+{
+  priority_ = priority;
+  priorityChanges++;
+}
+
+// Number of priority changes
+unsigned int OsiObject::priorityGeneration()
+{
+  return priorityChanges;
+}
+
 // Copy constructor
 OsiObject::OsiObject(const OsiObject &rhs)
 {
@@ -608,22 +635,35 @@ int OsiSimpleInteger::columnNumber() const
 {
   return columnNumber_;
 }
-// Creates a branching object
-OsiBranchingObject *
-OsiSimpleInteger::createBranch(OsiSolverInterface *solver, const OsiBranchingInformation *info, int way) const
+// Value to branch on (solution forced into bounds)
+static double integerBranchValue(int iColumn, const OsiBranchingInformation *info)
 {
-  double value = info->solution_[columnNumber_];
-  value = CoinMax(value, info->lower_[columnNumber_]);
-  value = CoinMin(value, info->upper_[columnNumber_]);
-  assert(info->upper_[columnNumber_] > info->lower_[columnNumber_]);
+  double value = info->solution_[iColumn];
+  value = CoinMax(value, info->lower_[iColumn]);
+  value = CoinMin(value, info->upper_[iColumn]);
+  assert(info->upper_[iColumn] > info->lower_[iColumn]);
 #ifndef NDEBUG
   double nearest = floor(value + 0.5);
   assert(fabs(value - nearest) > info->integerTolerance_);
 #endif
+  return value;
+}
+// Creates a branching object
+OsiBranchingObject *
+OsiSimpleInteger::createBranch(OsiSolverInterface *solver, const OsiBranchingInformation *info, int way) const
+{
+  double value = integerBranchValue(columnNumber_, info);
   OsiBranchingObject *branch = new OsiIntegerBranchingObject(solver, this, way,
     value);
   return branch;
 }
+// Resets an existing branching object
+void OsiSimpleInteger::resetBranch(OsiIntegerBranchingObject &branch, OsiSolverInterface *solver,
+  const OsiBranchingInformation *info, int way) const
+{
+  double value = integerBranchValue(columnNumber_, info);
+  branch = OsiIntegerBranchingObject(solver, this, way, value);
+}
 // Return "down" estimate
 double
 OsiSimpleInteger::downEstimate() const
@@ -827,6 +867,7 @@ OsiSOS::OsiSOS()
   , numberMembers_(0)
   , sosType_(-1)
   , integerValued_(false)
+  , weightsChecked_(false)
 {
 }
 
@@ -862,6 +903,7 @@ OsiSOS::OsiSOS(const OsiSolverInterface *, int numberMembers,
     weights_ = NULL;
   }
   assert(sosType_ > 0 && sosType_ < 3);
+  checkWeights();
 }
 
 // Copy constructor
@@ -871,6 +913,7 @@ OsiSOS::OsiSOS(const OsiSOS &rhs)
   numberMembers_ = rhs.numberMembers_;
   sosType_ = rhs.sosType_;
   integerValued_ = rhs.integerValued_;
+  weightsChecked_ = rhs.weightsChecked_;
   if (numberMembers_) {
     members_ = new int[numberMembers_];
     weights_ = new double[numberMembers_];
@@ -900,6 +943,7 @@ OsiSOS::operator=(const OsiSOS &rhs)
     numberMembers_ = rhs.numberMembers_;
     sosType_ = rhs.sosType_;
     integerValued_ = rhs.integerValued_;
+    weightsChecked_ = rhs.weightsChecked_;
     if (numberMembers_) {
       members_ = new int[numberMembers_];
       weights_ = new double[numberMembers_];
@@ -920,6 +964,20 @@ OsiSOS::~OsiSOS()
   delete[] weights_;
 }
 
+// Check weights are strictly increasing
+bool OsiSOS::checkWeights() const
+{
+  double lastWeight = -1.0e100;
+  int j;
+  for (j = 0; j < numberMembers_; j++) {
+    if (lastWeight >= weights_[j] - 1.0e-12)
+      break;
+    lastWeight = weights_[j];
+  }
+  weightsChecked_ = (j == numberMembers_);
+  return weightsChecked_;
+}
+
 // Infeasibility - large is 0.5
 double
 OsiSOS::infeasibility(const OsiBranchingInformation *info, int &whichWay) const
@@ -938,13 +996,12 @@ OsiSOS::infeasibility(const OsiBranchingInformation *info, int &whichWay) const
   double weight = 0.0;
   double sum = 0.0;
 
+  // weights only need checking when they have changed
+  if (!weightsChecked_ && !checkWeights())
+    throw CoinError("Weights too close together in SOS", "infeasibility", "OsiSOS");
   // check bounds etc
-  double lastWeight = -1.0e100;
   for (j = 0; j < numberMembers_; j++) {
     int iColumn = members_[j];
-    if (lastWeight >= weights_[j] - 1.0e-12)
-      throw CoinError("Weights too close together in SOS", "infeasibility", "OsiSOS");
-    lastWeight = weights_[j];
     if (upper[iColumn]) {
       double value = CoinMax(0.0, solution[iColumn]);
       if (value > integerTolerance) {
@@ -981,10 +1038,11 @@ OsiSOS::infeasibility(const OsiBranchingInformation *info, int &whichWay) const
     if (info->defaultDual_ >= 0.0) {
       // Using pseudo shadow prices
       weight /= sum;
-      int iWhere;
-      for (iWhere = firstNonZero; iWhere < lastNonZero; iWhere++)
-        if (weight < weights_[iWhere + 1])
-          break;
+      // last member not above weight - weights are increasing so bisect
+      int iWhere = static_cast< int >(std::upper_bound(weights_ + firstNonZero + 1,
+                                        weights_ + lastNonZero + 1, weight)
+                     - weights_)
+        - 1;
       assert(iWhere != lastNonZero);
       /* Complicated - infeasibility is being used for branching so we
 	 don't want estimate of satisfying set but of each way on branch.
@@ -1230,6 +1288,7 @@ void OsiSOS::resetSequenceEtc(int numberColumns, const int *originalColumns)
     printf("** SOS number of members reduced from %d to %d!\n", numberMembers_, n2);
     numberMembers_ = n2;
   }
+  checkWeights();
 }
 // Return "down" estimate
 double
@@ -1284,11 +1343,11 @@ OsiSOS::createBranch(OsiSolverInterface *solver, const OsiBranchingInformation *
   // find where to branch
   assert(sum > 0.0);
   weight /= sum;
-  int iWhere;
+  int iWhere = static_cast< int >(std::upper_bound(weights_ + firstNonZero + 1,
+                                    weights_ + lastNonZero + 1, weight)
+                 - weights_)
+    - 1;
   double separator = 0.0;
-  for (iWhere = firstNonZero; iWhere < lastNonZero; iWhere++)
-    if (weight < weights_[iWhere + 1])
-      break;
   if (sosType_ == 1) {
     // SOS 1
     separator = 0.5 * (weights_[iWhere] + weights_[iWhere + 1]);
@@ -1356,24 +1415,17 @@ OsiSOSBranchingObject::branch(OsiSolverInterface *solver)
   //const double * lower = solver->getColLower();
   //const double * upper = solver->getColUpper();
   // *** for way - up means fix all those in down section
+  // weights are increasing so split point can be found by bisection
   if (way < 0) {
-    int i;
-    for (i = 0; i < numberMembers; i++) {
-      if (weights[i] > value_)
-        break;
-    }
+    int i = static_cast< int >(std::upper_bound(weights, weights + numberMembers, value_) - weights);
     assert(i < numberMembers);
     for (; i < numberMembers; i++)
       solver->setColUpper(which[i], 0.0);
   } else {
-    int i;
-    for (i = 0; i < numberMembers; i++) {
-      if (weights[i] >= value_)
-        break;
-      else
-        solver->setColUpper(which[i], 0.0);
-    }
-    assert(i < numberMembers);
+    int iEnd = static_cast< int >(std::lower_bound(weights, weights + numberMembers, value_) - weights);
+    assert(iEnd < numberMembers);
+    for (int i = 0; i < iEnd; i++)
+      solver->setColUpper(which[i], 0.0);
   }
   return 0.0;
 }
@@ -18,6 +18,7 @@ class OsiSolverBranch;
 
 class OsiBranchingObject;
 class OsiBranchingInformation;
+class OsiIntegerBranchingObject;
 
 //#############################################################################
 //This contains the abstract base class for an object and for branching.
@@ -146,11 +147,11 @@ public:
   {
     return priority_;
   }
-  /// Set priority
-  inline void setPriority(int priority)
-  {
-    priority_ = priority;
-  }
+  /// Set priority (counted in #priorityGeneration)
+  void setPriority(int priority);
+  /** Number of calls to setPriority on any object. Choosers which keep
+      priorities compare it to see if they have to read them again. */
+  static unsigned int priorityGeneration();
   /** \brief Return true if branch should only bound variables
   */
   virtual bool boundBranch() const
@@ -599,6 +600,13 @@ public:
   */
   virtual OsiBranchingObject *createBranch(OsiSolverInterface *solver, const OsiBranchingInformation *info, int way) const;
 
+  /** Reset an existing branching object to what createBranch would give.
+
+    Lets strong branching reuse its objects instead of allocating new ones.
+  */
+  void resetBranch(OsiIntegerBranchingObject &branch, OsiSolverInterface *solver,
+    const OsiBranchingInformation *info, int way) const;
+
   /// Set solver column number
   inline void setColumnNumber(int value)
   {
@@ -827,6 +835,7 @@ public:
   inline void setNumberMembers(int value)
   {
     numberMembers_ = value;
+    weightsChecked_ = false;
   }
 
   /// Members (indices in range 0 ... numberColumns-1)
@@ -841,12 +850,23 @@ public:
     sosType_ = value;
   }
 
-  /** Array of weights */
+  /** Array of weights
+
+    Weights are checked again on the next call to infeasibility.
+  */
   inline double *mutableWeights() const
   {
+    weightsChecked_ = false;
     return weights_;
   }
 
+protected:
+  /** Check weights are strictly increasing.
+
+    Records the result so infeasibility does not have to check each call.
+  */
+  bool checkWeights() const;
+
 protected:
   /// data
 
@@ -861,6 +881,8 @@ protected:
   int sosType_;
   /// Whether integer valued
   bool integerValued_;
+  /// True if weights known to be strictly increasing
+  mutable bool weightsChecked_;
 };
 
 /** Branching object for Special ordered sets
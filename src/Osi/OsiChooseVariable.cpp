@@ -3,9 +3,12 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include <string>
+#include <cstring>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
+#include <algorithm>
+#include <typeinfo>
 #include "CoinPragma.hpp"
 #include "OsiSolverInterface.hpp"
 #include "OsiAuxInfo.hpp"
@@ -39,6 +42,26 @@ OsiChooseVariable::OsiChooseVariable()
   , numberStrongFixed_(0)
   , trustStrongForBound_(true)
   , trustStrongForSolution_(true)
+  , incremental_(false)
+  , mappedObjects_(0)
+  , mappedColumns_(0)
+  , mappedObjectArray_(NULL)
+  , mappedGeneration_(0)
+  , objectStart_(NULL)
+  , objectIndex_(NULL)
+  , cachedInfeasibility_(NULL)
+  , cachedWay_(NULL)
+  , objectChanged_(NULL)
+  , bulkSimpleIntegers_(true)
+  , simpleObjects_(NULL)
+  , simpleNumber_(-1)
+  , simpleGeneration_(0)
+  , simplePriorityGeneration_(0)
+  , simpleColumn_(NULL)
+  , simplePriority_(NULL)
+  , simpleValue_(NULL)
+  , scanList_(NULL)
+  , scanValue_(NULL)
 {
 }
 
@@ -61,6 +84,26 @@ OsiChooseVariable::OsiChooseVariable(const OsiSolverInterface *solver)
   , numberStrongFixed_(0)
   , trustStrongForBound_(true)
   , trustStrongForSolution_(true)
+  , incremental_(false)
+  , mappedObjects_(0)
+  , mappedColumns_(0)
+  , mappedObjectArray_(NULL)
+  , mappedGeneration_(0)
+  , objectStart_(NULL)
+  , objectIndex_(NULL)
+  , cachedInfeasibility_(NULL)
+  , cachedWay_(NULL)
+  , objectChanged_(NULL)
+  , bulkSimpleIntegers_(true)
+  , simpleObjects_(NULL)
+  , simpleNumber_(-1)
+  , simpleGeneration_(0)
+  , simplePriorityGeneration_(0)
+  , simpleColumn_(NULL)
+  , simplePriority_(NULL)
+  , simpleValue_(NULL)
+  , scanList_(NULL)
+  , scanValue_(NULL)
 {
   // create useful arrays
   int numberObjects = solver_->numberObjects();
@@ -86,6 +129,28 @@ OsiChooseVariable::OsiChooseVariable(const OsiChooseVariable &rhs)
   numberStrongFixed_ = rhs.numberStrongFixed_;
   trustStrongForBound_ = rhs.trustStrongForBound_;
   trustStrongForSolution_ = rhs.trustStrongForSolution_;
+  // incremental data is rebuilt on first scan
+  incremental_ = rhs.incremental_;
+  mappedObjects_ = 0;
+  mappedColumns_ = 0;
+  mappedObjectArray_ = NULL;
+  mappedGeneration_ = 0;
+  objectStart_ = NULL;
+  objectIndex_ = NULL;
+  cachedInfeasibility_ = NULL;
+  cachedWay_ = NULL;
+  objectChanged_ = NULL;
+  // simple integer arrays are rebuilt on first scan
+  bulkSimpleIntegers_ = rhs.bulkSimpleIntegers_;
+  simpleObjects_ = NULL;
+  simpleNumber_ = -1;
+  simpleGeneration_ = 0;
+  simplePriorityGeneration_ = 0;
+  simpleColumn_ = NULL;
+  simplePriority_ = NULL;
+  simpleValue_ = NULL;
+  scanList_ = NULL;
+  scanValue_ = NULL;
   solver_ = rhs.solver_;
   if (solver_) {
     int numberObjects = solver_->numberObjects();
@@ -127,6 +192,10 @@ OsiChooseVariable::operator=(const OsiChooseVariable &rhs)
     numberStrongFixed_ = rhs.numberStrongFixed_;
     trustStrongForBound_ = rhs.trustStrongForBound_;
     trustStrongForSolution_ = rhs.trustStrongForSolution_;
+    deleteIncremental();
+    incremental_ = rhs.incremental_;
+    deleteSimpleIntegers();
+    bulkSimpleIntegers_ = rhs.bulkSimpleIntegers_;
     solver_ = rhs.solver_;
     if (solver_) {
       int numberObjects = solver_->numberObjects();
@@ -152,6 +221,8 @@ OsiChooseVariable::~OsiChooseVariable()
   delete[] goodSolution_;
   delete[] list_;
   delete[] useful_;
+  deleteIncremental();
+  deleteSimpleIntegers();
 }
 
 // Clone
@@ -170,6 +241,267 @@ void OsiChooseVariable::setSolver(const OsiSolverInterface *solver)
   int numberObjects = solver_->numberObjects();
   list_ = new int[numberObjects];
   useful_ = new double[numberObjects];
+  deleteIncremental();
+  deleteSimpleIntegers();
+}
+
+// Switch incremental candidate scans on or off
+void OsiChooseVariable::setIncremental(bool yesNo)
+{
+  incremental_ = yesNo;
+  if (!yesNo)
+    deleteIncremental();
+  else
+    markAllChanged();
+}
+
+void OsiChooseVariable::deleteIncremental()
+{
+  delete[] objectStart_;
+  delete[] objectIndex_;
+  delete[] cachedInfeasibility_;
+  delete[] cachedWay_;
+  delete[] objectChanged_;
+  objectStart_ = NULL;
+  objectIndex_ = NULL;
+  cachedInfeasibility_ = NULL;
+  cachedWay_ = NULL;
+  objectChanged_ = NULL;
+  mappedObjects_ = 0;
+  mappedColumns_ = 0;
+  mappedObjectArray_ = NULL;
+  mappedGeneration_ = 0;
+}
+
+/*
+  Build the column to object map if we don't have one, the problem has
+  changed shape or the objects have changed (a new array, or a new model
+  generation for objects replaced or deleted in place). A single column
+  object references columnNumber(), an OsiSOS references its members.
+  Anything else is always re-evaluated.
+*/
+void OsiChooseVariable::prepareIncremental(const OsiBranchingInformation *info)
+{
+  const OsiSolverInterface *solver = info->solver_;
+  int numberObjects = solver->numberObjects();
+  int numberColumns = solver->getNumCols();
+  OsiObject **object = solver->objects();
+  unsigned int generation = solver->modelGeneration();
+  if (objectStart_ && numberObjects == mappedObjects_ && numberColumns == mappedColumns_
+    && object == mappedObjectArray_ && generation == mappedGeneration_)
+    return;
+  deleteIncremental();
+  mappedObjects_ = numberObjects;
+  mappedColumns_ = numberColumns;
+  mappedObjectArray_ = object;
+  mappedGeneration_ = generation;
+  objectStart_ = new int[numberColumns + 1];
+  cachedInfeasibility_ = new double[numberObjects];
+  cachedWay_ = new int[numberObjects];
+  objectChanged_ = new char[numberObjects];
+  CoinZeroN(objectStart_, numberColumns + 1);
+  CoinZeroN(cachedInfeasibility_, numberObjects);
+  CoinZeroN(cachedWay_, numberObjects);
+  int i;
+  // count
+  for (i = 0; i < numberObjects; i++) {
+    int iColumn = object[i]->columnNumber();
+    const OsiSOS *sos = dynamic_cast< const OsiSOS * >(object[i]);
+    if (iColumn >= 0 && iColumn < numberColumns) {
+      objectStart_[iColumn]++;
+      objectChanged_[i] = 1;
+    } else if (sos) {
+      const int *members = sos->members();
+      for (int j = 0; j < sos->numberMembers(); j++)
+        objectStart_[members[j]]++;
+      objectChanged_[i] = 1;
+    } else {
+      objectChanged_[i] = 2;
+    }
+  }
+  // starts are end of each column until filled in
+  int n = 0;
+  for (i = 0; i < numberColumns; i++) {
+    n += objectStart_[i];
+    objectStart_[i] = n;
+  }
+  objectStart_[numberColumns] = n;
+  objectIndex_ = new int[CoinMax(n, 1)];
+  for (i = numberObjects - 1; i >= 0; i--) {
+    if (objectChanged_[i] == 2)
+      continue;
+    int iColumn = object[i]->columnNumber();
+    if (iColumn >= 0 && iColumn < numberColumns) {
+      objectIndex_[--objectStart_[iColumn]] = i;
+    } else {
+      const OsiSOS *sos = dynamic_cast< const OsiSOS * >(object[i]);
+      const int *members = sos->members();
+      for (int j = 0; j < sos->numberMembers(); j++)
+        objectIndex_[--objectStart_[members[j]]] = i;
+    }
+  }
+}
+
+// Report columns whose value or bounds changed since last scan
+void OsiChooseVariable::markChangedColumns(int numberChanged, const int *which)
+{
+  if (!objectStart_)
+    return; // everything will be evaluated anyway
+  for (int i = 0; i < numberChanged; i++) {
+    int iColumn = which[i];
+    if (iColumn < 0 || iColumn >= mappedColumns_)
+      continue;
+    for (int k = objectStart_[iColumn]; k < objectStart_[iColumn + 1]; k++) {
+      int iObject = objectIndex_[k];
+      if (!objectChanged_[iObject])
+        objectChanged_[iObject] = 1;
+    }
+  }
+}
+
+// Make next incremental scan evaluate every object
+void OsiChooseVariable::markAllChanged()
+{
+  for (int i = 0; i < mappedObjects_; i++) {
+    if (!objectChanged_[i])
+      objectChanged_[i] = 1;
+  }
+}
+
+/*
+  Infeasibility of one object. The object keeps its own infeasibility_ from
+  the last evaluation, so estimates stay right for a cached object. whichWay_
+  may have been changed by chooseVariable since, so put that back.
+*/
+double OsiChooseVariable::objectInfeasibility(const OsiBranchingInformation *info,
+  int iObject, int &way)
+{
+  OsiObject *object = info->solver_->objects()[iObject];
+  if (!incremental_) {
+    return object->infeasibility(info, way);
+  } else if (!objectChanged_[iObject]) {
+    way = cachedWay_[iObject];
+    object->setWhichWay(way);
+    return cachedInfeasibility_[iObject];
+  } else {
+    double value = object->infeasibility(info, way);
+    cachedInfeasibility_[iObject] = value;
+    cachedWay_[iObject] = way;
+    if (objectChanged_[iObject] == 1)
+      objectChanged_[iObject] = 0;
+    return value;
+  }
+}
+
+void OsiChooseVariable::deleteSimpleIntegers()
+{
+  delete[] simpleColumn_;
+  delete[] simplePriority_;
+  delete[] simpleValue_;
+  delete[] scanList_;
+  delete[] scanValue_;
+  simpleObjects_ = NULL;
+  simpleNumber_ = -1;
+  simpleGeneration_ = 0;
+  simplePriorityGeneration_ = 0;
+  simpleColumn_ = NULL;
+  simplePriority_ = NULL;
+  simpleValue_ = NULL;
+  scanList_ = NULL;
+  scanValue_ = NULL;
+}
+
+/*
+  Bulk scan when all objects are plain OsiSimpleInteger. This computes the
+  same infeasibility as OsiSimpleInteger::infeasibility with pseudo shadow
+  prices off, but the first pass has no branches or virtual calls so the
+  compiler can vectorize it. Objects are not touched, so their mutable
+  infeasibility and way are not updated here.
+*/
+int OsiChooseVariable::scanSimpleIntegers(const OsiBranchingInformation *info)
+{
+  if (!bulkSimpleIntegers_ || info->defaultDual_ >= 0.0)
+    return -1;
+  const OsiSolverInterface *solver = info->solver_;
+  int numberObjects = solver->numberObjects();
+  OsiObject **object = solver->objects();
+  unsigned int generation = solver->modelGeneration();
+  unsigned int priorityGeneration = OsiObject::priorityGeneration();
+  int i;
+  if (object != simpleObjects_ || numberObjects != simpleNumber_
+    || generation != simpleGeneration_) {
+    deleteSimpleIntegers();
+    simpleObjects_ = object;
+    simpleNumber_ = numberObjects;
+    simpleGeneration_ = generation;
+    simplePriorityGeneration_ = priorityGeneration;
+    for (i = 0; i < numberObjects; i++) {
+      if (typeid(*object[i]) != typeid(OsiSimpleInteger))
+        break;
+    }
+    if (i == numberObjects) {
+      simpleColumn_ = new int[numberObjects];
+      simplePriority_ = new int[numberObjects];
+      simpleValue_ = new double[numberObjects];
+      scanList_ = new int[numberObjects];
+      scanValue_ = new double[numberObjects];
+      for (i = 0; i < numberObjects; i++) {
+        simpleColumn_[i] = object[i]->columnNumber();
+        simplePriority_[i] = object[i]->priority();
+      }
+    }
+  } else if (priorityGeneration != simplePriorityGeneration_) {
+    // some priority was changed in place
+    simplePriorityGeneration_ = priorityGeneration;
+    if (simpleColumn_) {
+      for (i = 0; i < numberObjects; i++)
+        simplePriority_[i] = object[i]->priority();
+    }
+  }
+  if (!simpleColumn_)
+    return -1;
+  const double *solution = info->solution_;
+  const double *lower = info->lower_;
+  const double *upper = info->upper_;
+  const double integerTolerance = info->integerTolerance_;
+  const int *column = simpleColumn_;
+  double *value = simpleValue_;
+  for (i = 0; i < numberObjects; i++) {
+    int iColumn = column[i];
+    double x = CoinMin(CoinMax(solution[iColumn], lower[iColumn]), upper[iColumn]);
+    double away = fabs(x - floor(x + 0.5));
+    value[i] = (away > integerTolerance) ? away : 0.0;
+  }
+  int numberScanned = 0;
+  for (i = 0; i < numberObjects; i++) {
+    if (value[i]) {
+      scanList_[numberScanned] = i;
+      scanValue_[numberScanned++] = value[i];
+    }
+  }
+  return numberScanned;
+}
+
+namespace {
+// Orders positions in the scan arrays by decreasing infeasibility
+class OsiScanOrder {
+public:
+  OsiScanOrder(const double *value, const int *which)
+    : value_(value)
+    , which_(which)
+  {
+  }
+  bool operator()(int a, int b) const
+  {
+    if (value_[a] != value_[b])
+      return value_[a] > value_[b];
+    return which_[a] < which_[b];
+  }
+
+private:
+  const double *value_;
+  const int *which_;
+};
 }
 
 // Initialize
@@ -201,11 +533,57 @@ int OsiChooseVariable::setupList(OsiBranchingInformation *info, bool initialize)
     useful_[i] = 0.0;
   }
   OsiObject **object = info->solver_->objects();
+  if (incremental_)
+    prepareIncremental(info);
+  int numberScanned = incremental_ ? -1 : scanSimpleIntegers(info);
+  if (numberScanned >= 0) {
+    /*
+      Bulk scan. Take the unsatisfied objects of best priority to the front
+      of scanList_ and the rest to the end of list_, then choose the most
+      infeasible with a partial sort over positions held at the front of
+      list_.
+    */
+    numberUnsatisfied_ = numberScanned;
+    int k;
+    for (k = 0; k < numberScanned; k++)
+      bestPriority = CoinMin(bestPriority, simplePriority_[scanList_[k]]);
+    int numberBest = 0;
+    for (k = 0; k < numberScanned; k++) {
+      int iObject = scanList_[k];
+      if (simplePriority_[iObject] == bestPriority) {
+        scanList_[numberBest] = iObject;
+        scanValue_[numberBest++] = scanValue_[k];
+      } else {
+        list_[--putOther] = iObject;
+      }
+    }
+    int numberKeep = CoinMin(maximumStrong, numberBest);
+    for (k = 0; k < numberBest; k++)
+      list_[k] = k;
+    std::partial_sort(list_, list_ + numberKeep, list_ + numberBest,
+      OsiScanOrder(scanValue_, scanList_));
+    for (k = 0; k < numberBest; k++) {
+      int j = list_[k];
+      list_[k] = scanList_[j];
+      useful_[k] = -scanValue_[j];
+    }
+    // move others
+    for (k = numberBest; putOther < numberObjects; putOther++)
+      list_[k++] = list_[putOther];
+    assert(k == numberUnsatisfied_);
+    // bring the chosen objects up to date
+    for (k = 0; k < numberKeep; k++) {
+      int way;
+      object[list_[k]]->infeasibility(info, way);
+    }
+    numberOnList_ = numberStrong_ ? numberKeep : 0;
+    return numberUnsatisfied_;
+  }
   // Say feasible
   bool feasible = true;
   for (i = 0; i < numberObjects; i++) {
     int way;
-    double value = object[i]->infeasibility(info, way);
+    double value = objectInfeasibility(info, i, way);
     if (value > 0.0) {
       numberUnsatisfied_++;
       if (value == COIN_DBL_MAX) {
@@ -359,16 +737,24 @@ int OsiChooseStrong::doStrongBranching(OsiSolverInterface *solver,
   OsiBranchingInformation *info,
   int numberToDo, int returnCriterion)
 {
+  OSI_TRACE_SCOPE("doStrongBranching");
 
   // Might be faster to extend branch() to return bounds changed
-  double *saveLower = NULL;
-  double *saveUpper = NULL;
   int numberColumns = solver->getNumCols();
   solver->markHotStart();
   const double *lower = info->lower_;
   const double *upper = info->upper_;
-  saveLower = CoinCopyOfArray(info->lower_, numberColumns);
-  saveUpper = CoinCopyOfArray(info->upper_, numberColumns);
+  if (numberColumns > sizeSave_) {
+    delete[] saveLower_;
+    delete[] saveUpper_;
+    sizeSave_ = numberColumns;
+    saveLower_ = new double[numberColumns];
+    saveUpper_ = new double[numberColumns];
+  }
+  double *saveLower = saveLower_;
+  double *saveUpper = saveUpper_;
+  CoinMemcpyN(info->lower_, numberColumns, saveLower);
+  CoinMemcpyN(info->upper_, numberColumns, saveUpper);
   numResults_ = 0;
   int returnCode = 0;
   double timeStart = CoinCpuTime();
@@ -377,86 +763,96 @@ int OsiChooseStrong::doStrongBranching(OsiSolverInterface *solver,
     // For now just 2 way
     OsiBranchingObject *branch = result->branchingObject();
     assert(branch->numberBranches() == 2);
-    /*
-      Try the first direction.  Each subsequent call to branch() performs the
-      specified branch and advances the branch object state to the next branch
-      alternative.)
-    */
-    OsiSolverInterface *thisSolver = solver;
-    if (branch->boundBranch()) {
-      // ordinary
-      branch->branch(solver);
-      // maybe we should check bounds for stupidities here?
-      solver->solveFromHotStart();
+    int status0;
+    int status1;
+    if (result->downStatus() >= 0 && result->upStatus() >= 0) {
+      // answered from cache
+      status0 = result->downStatus();
+      status1 = result->upStatus();
     } else {
-      // adding cuts or something
-      thisSolver = solver->clone();
-      branch->branch(thisSolver);
-      // set hot start iterations
-      int limit;
-      thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
-      thisSolver->setIntParam(OsiMaxNumIteration, limit);
-      thisSolver->resolve();
-    }
-    // can check if we got solution
-    // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
-    int status0 = result->updateInformation(thisSolver, info, this);
-    numberStrongIterations_ += thisSolver->getIterationCount();
-    if (status0 == 3) {
-      // new solution already saved
-      if (trustStrongForSolution_) {
-        info->cutoff_ = goodObjectiveValue_;
-        status0 = 0;
+      /*
+        Try the first direction.  Each subsequent call to branch() performs the
+        specified branch and advances the branch object state to the next branch
+        alternative.)
+      */
+      OsiSolverInterface *thisSolver = solver;
+      if (branch->boundBranch()) {
+        // ordinary
+        branch->branch(solver);
+        // maybe we should check bounds for stupidities here?
+        solver->solveFromHotStart();
+      } else {
+        // adding cuts or something
+        thisSolver = solver->clone();
+        branch->branch(thisSolver);
+        // set hot start iterations
+        int limit;
+        thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
+        thisSolver->setIntParam(OsiMaxNumIteration, limit);
+        thisSolver->resolve();
       }
-    }
-    if (solver != thisSolver)
-      delete thisSolver;
-    // Restore bounds
-    for (int j = 0; j < numberColumns; j++) {
-      if (saveLower[j] != lower[j])
-        solver->setColLower(j, saveLower[j]);
-      if (saveUpper[j] != upper[j])
-        solver->setColUpper(j, saveUpper[j]);
-    }
-    /*
-      Try the next direction
-    */
-    thisSolver = solver;
-    if (branch->boundBranch()) {
-      // ordinary
-      branch->branch(solver);
-      // maybe we should check bounds for stupidities here?
-      solver->solveFromHotStart();
-    } else {
-      // adding cuts or something
-      thisSolver = solver->clone();
-      branch->branch(thisSolver);
-      // set hot start iterations
-      int limit;
-      thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
-      thisSolver->setIntParam(OsiMaxNumIteration, limit);
-      thisSolver->resolve();
-    }
-    // can check if we got solution
-    // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
-    int status1 = result->updateInformation(thisSolver, info, this);
-    numberStrongDone_++;
-    numberStrongIterations_ += thisSolver->getIterationCount();
-    if (status1 == 3) {
-      // new solution already saved
-      if (trustStrongForSolution_) {
-        info->cutoff_ = goodObjectiveValue_;
-        status1 = 0;
+      // can check if we got solution
+      // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
+      status0 = result->updateInformation(thisSolver, info, this);
+      numberStrongIterations_ += thisSolver->getIterationCount();
+      if (status0 == 3) {
+        // new solution already saved
+        if (trustStrongForSolution_) {
+          info->cutoff_ = goodObjectiveValue_;
+          status0 = 0;
+        }
       }
-    }
-    if (solver != thisSolver)
-      delete thisSolver;
-    // Restore bounds
-    for (int j = 0; j < numberColumns; j++) {
-      if (saveLower[j] != lower[j])
-        solver->setColLower(j, saveLower[j]);
-      if (saveUpper[j] != upper[j])
-        solver->setColUpper(j, saveUpper[j]);
+      if (solver != thisSolver)
+        delete thisSolver;
+      // Restore bounds
+      for (int j = 0; j < numberColumns; j++) {
+        if (saveLower[j] != lower[j])
+          solver->setColLower(j, saveLower[j]);
+        if (saveUpper[j] != upper[j])
+          solver->setColUpper(j, saveUpper[j]);
+      }
+      /*
+        Try the next direction
+      */
+      thisSolver = solver;
+      if (branch->boundBranch()) {
+        // ordinary
+        branch->branch(solver);
+        // maybe we should check bounds for stupidities here?
+        solver->solveFromHotStart();
+      } else {
+        // adding cuts or something
+        thisSolver = solver->clone();
+        branch->branch(thisSolver);
+        // set hot start iterations
+        int limit;
+        thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
+        thisSolver->setIntParam(OsiMaxNumIteration, limit);
+        thisSolver->resolve();
+      }
+      // can check if we got solution
+      // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
+      status1 = result->updateInformation(thisSolver, info, this);
+      numberStrongDone_++;
+      numberStrongIterations_ += thisSolver->getIterationCount();
+      if (status1 == 3) {
+        // new solution already saved
+        if (trustStrongForSolution_) {
+          info->cutoff_ = goodObjectiveValue_;
+          status1 = 0;
+        }
+      }
+      if (solver != thisSolver)
+        delete thisSolver;
+      // Restore bounds
+      for (int j = 0; j < numberColumns; j++) {
+        if (saveLower[j] != lower[j])
+          solver->setColLower(j, saveLower[j]);
+        if (saveUpper[j] != upper[j])
+          solver->setColUpper(j, saveUpper[j]);
+      }
+      if (cache_)
+        storeStrongCache(*result, info);
     }
     /*
       End of evaluation for this candidate variable. Possibilities are:
@@ -488,8 +884,6 @@ int OsiChooseStrong::doStrongBranching(OsiSolverInterface *solver,
       break;
     }
   }
-  delete[] saveLower;
-  delete[] saveUpper;
   // Delete the snapshot
   solver->unmarkHotStart();
   return returnCode;
@@ -612,6 +1006,16 @@ OsiChooseStrong::OsiChooseStrong()
   , pseudoCosts_()
   , results_(NULL)
   , numResults_(0)
+  , maximumResults_(0)
+  , saveLower_(NULL)
+  , saveUpper_(NULL)
+  , sizeSave_(0)
+  , cache_(NULL)
+  , sizeCache_(0)
+  , cacheTolerance_(1.0e-7)
+  , nodeFingerprint_(0)
+  , numberCacheHits_(0)
+  , numberCacheMisses_(0)
 {
 }
 
@@ -621,6 +1025,16 @@ OsiChooseStrong::OsiChooseStrong(const OsiSolverInterface *solver)
   , pseudoCosts_()
   , results_(NULL)
   , numResults_(0)
+  , maximumResults_(0)
+  , saveLower_(NULL)
+  , saveUpper_(NULL)
+  , sizeSave_(0)
+  , cache_(NULL)
+  , sizeCache_(0)
+  , cacheTolerance_(1.0e-7)
+  , nodeFingerprint_(0)
+  , numberCacheHits_(0)
+  , numberCacheMisses_(0)
 {
   // create useful arrays
   pseudoCosts_.initialize(solver_->numberObjects());
@@ -632,7 +1046,19 @@ OsiChooseStrong::OsiChooseStrong(const OsiChooseStrong &rhs)
   , pseudoCosts_(rhs.pseudoCosts_)
   , results_(NULL)
   , numResults_(0)
+  , maximumResults_(0)
+  , saveLower_(NULL)
+  , saveUpper_(NULL)
+  , sizeSave_(0)
+  , cache_(NULL)
+  , sizeCache_(0)
+  , cacheTolerance_(1.0e-7)
+  , nodeFingerprint_(0)
+  , numberCacheHits_(0)
+  , numberCacheMisses_(0)
 {
+  // same cache settings but nothing remembered
+  setStrongCache(rhs.sizeCache_, rhs.cacheTolerance_);
 }
 
 OsiChooseStrong &
@@ -645,6 +1071,8 @@ OsiChooseStrong::operator=(const OsiChooseStrong &rhs)
     delete[] results_;
     results_ = NULL;
     numResults_ = 0;
+    maximumResults_ = 0;
+    setStrongCache(rhs.sizeCache_, rhs.cacheTolerance_);
   }
   return *this;
 }
@@ -652,6 +1080,9 @@ OsiChooseStrong::operator=(const OsiChooseStrong &rhs)
 OsiChooseStrong::~OsiChooseStrong()
 {
   delete[] results_;
+  delete[] saveLower_;
+  delete[] saveUpper_;
+  delete[] cache_;
 }
 
 // Clone
@@ -718,6 +1149,15 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
       info->indexRegion_ = new int[size];
     }
   }
+  if (incremental_) {
+    prepareIncremental(info);
+    // pseudo shadow prices depend on the duals, not just the columns
+    if (shadowPossible)
+      markAllChanged();
+  }
+  // With a bulk scan only the unsatisfied objects need be looked at
+  int numberScanned = incremental_ ? -1 : scanSimpleIntegers(info);
+  int numberToScan = (numberScanned >= 0) ? numberScanned : numberObjects;
   double sumUp = 0.0;
   double numberUp = 0.0;
   double sumDown = 0.0;
@@ -741,9 +1181,16 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
   int pri[]={10,1000,10000};
   int priCount[]={0,0,0};
 #endif
-  for (i = 0; i < numberObjects; i++) {
+  for (int k = 0; k < numberToScan; k++) {
     int way;
-    double value = object[i]->infeasibility(info, way);
+    double value;
+    if (numberScanned >= 0) {
+      i = scanList_[k];
+      value = object[i]->infeasibility(info, way);
+    } else {
+      i = k;
+      value = objectInfeasibility(info, i, way);
+    }
     if (value > 0.0) {
       numberUnsatisfied_++;
       if (value == COIN_DBL_MAX) {
@@ -867,11 +1314,83 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
   return numberUnsatisfied_;
 }
 
+// Switch strong branching cache on (size>0) or off
+void OsiChooseStrong::setStrongCache(int size, double tolerance)
+{
+  delete[] cache_;
+  cache_ = NULL;
+  sizeCache_ = CoinMax(size, 0);
+  cacheTolerance_ = tolerance;
+  numberCacheHits_ = 0;
+  numberCacheMisses_ = 0;
+  if (sizeCache_) {
+    cache_ = new OsiStrongCacheEntry[sizeCache_];
+    for (int i = 0; i < sizeCache_; i++)
+      cache_[i].whichObject = -1;
+  }
+}
+
+// FNV-1a hash of bit patterns of bounds
+static CoinUInt64 boundsFingerprint(const double *lower, const double *upper, int n)
+{
+  CoinUInt64 hash = 14695981039346656037ULL;
+  for (int i = 0; i < n; i++) {
+    CoinUInt64 bits;
+    memcpy(&bits, lower + i, sizeof(bits));
+    hash = (hash ^ bits) * 1099511628211ULL;
+    memcpy(&bits, upper + i, sizeof(bits));
+    hash = (hash ^ bits) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+// Slot in cache for object at current node
+static int cacheSlot(CoinUInt64 fingerprint, int whichObject, int size)
+{
+  CoinUInt64 key = fingerprint ^ (static_cast< CoinUInt64 >(whichObject) * 0x9e3779b97f4a7c15ULL);
+  return static_cast< int >(key % static_cast< CoinUInt64 >(size));
+}
+
+bool OsiChooseStrong::lookupStrongCache(OsiHotInfo &result, const OsiBranchingInformation *info)
+{
+  int whichObject = result.whichObject();
+  const OsiStrongCacheEntry &entry = cache_[cacheSlot(nodeFingerprint_, whichObject, sizeCache_)];
+  if (entry.whichObject == whichObject && entry.fingerprint == nodeFingerprint_
+    && fabs(entry.objectiveValue - info->objectiveValue_) <= cacheTolerance_) {
+    result.setDownChange(entry.changes[0]);
+    result.setUpChange(entry.changes[1]);
+    result.setDownStatus(entry.statuses[0]);
+    result.setUpStatus(entry.statuses[1]);
+    numberCacheHits_++;
+    return true;
+  } else {
+    numberCacheMisses_++;
+    return false;
+  }
+}
+
+void OsiChooseStrong::storeStrongCache(const OsiHotInfo &result, const OsiBranchingInformation *info)
+{
+  int whichObject = result.whichObject();
+  OsiStrongCacheEntry &entry = cache_[cacheSlot(nodeFingerprint_, whichObject, sizeCache_)];
+  entry.fingerprint = nodeFingerprint_;
+  entry.objectiveValue = info->objectiveValue_;
+  entry.changes[0] = result.downChange();
+  entry.changes[1] = result.upChange();
+  entry.statuses[0] = result.downStatus();
+  entry.statuses[1] = result.upStatus();
+  entry.whichObject = whichObject;
+}
+
 void OsiChooseStrong::resetResults(int num)
 {
-  delete[] results_;
   numResults_ = 0;
-  results_ = new OsiHotInfo[num];
+  // entries are reinitialized as used, so only grow
+  if (num > maximumResults_) {
+    delete[] results_;
+    maximumResults_ = num;
+    results_ = new OsiHotInfo[num];
+  }
 }
 
 /* Choose a variable
@@ -903,6 +1422,8 @@ int OsiChooseStrong::chooseVariable(OsiSolverInterface *solver, OsiBranchingInfo
     int numberLeft = CoinMin(numberStrong_ - numberStrongDone_, numberUnsatisfied_);
     int numberToDo = 0;
     resetResults(numberLeft);
+    if (cache_)
+      nodeFingerprint_ = boundsFingerprint(info->lower_, info->upper_, solver->getNumCols());
     int returnCode = 0;
     bestObjectIndex_ = -1;
     bestWhichWay_ = -1;
@@ -912,8 +1433,11 @@ int OsiChooseStrong::chooseVariable(OsiSolverInterface *solver, OsiBranchingInfo
     for (int i = 0; i < numberLeft; i++) {
       int iObject = list_[i];
       if (upNumber[iObject] < numberBeforeTrusted || downNumber[iObject] < numberBeforeTrusted) {
-        results_[numberToDo++] = OsiHotInfo(solver, info,
-          solver->objects(), iObject);
+        OsiHotInfo &result = results_[numberToDo++];
+        result.initialize(solver, info, solver->objects(), iObject);
+        // statuses left at -1 unless found in cache
+        if (cache_ && result.branchingObject()->numberBranches() == 2)
+          lookupStrongCache(result, info);
       } else {
         const OsiObject *obj = solver->object(iObject);
         double upEstimate = (upTotalChange[iObject] * obj->upEstimate()) / upNumber[iObject];
@@ -1087,6 +1611,7 @@ OsiHotInfo::OsiHotInfo()
   , statuses_(NULL)
   , branchingObject_(NULL)
   , whichObject_(-1)
+  , maximumBranches_(0)
 {
 }
 
@@ -1103,6 +1628,7 @@ OsiHotInfo::OsiHotInfo(OsiSolverInterface *solver,
   branchingObject_ = object->createBranch(solver, info, 0);
   // create arrays
   int numberBranches = branchingObject_->numberBranches();
+  maximumBranches_ = numberBranches;
   changes_ = new double[numberBranches];
   iterationCounts_ = new int[numberBranches];
   statuses_ = new int[numberBranches];
@@ -1118,6 +1644,7 @@ OsiHotInfo::OsiHotInfo(const OsiHotInfo &rhs)
   if (rhs.branchingObject_) {
     branchingObject_ = rhs.branchingObject_->clone();
     int numberBranches = branchingObject_->numberBranches();
+    maximumBranches_ = numberBranches;
     changes_ = CoinCopyOfArray(rhs.changes_, numberBranches);
     iterationCounts_ = CoinCopyOfArray(rhs.iterationCounts_, numberBranches);
     statuses_ = CoinCopyOfArray(rhs.statuses_, numberBranches);
@@ -1126,6 +1653,7 @@ OsiHotInfo::OsiHotInfo(const OsiHotInfo &rhs)
     changes_ = NULL;
     iterationCounts_ = NULL;
     statuses_ = NULL;
+    maximumBranches_ = 0;
   }
 }
 
@@ -1142,6 +1670,7 @@ OsiHotInfo::operator=(const OsiHotInfo &rhs)
     if (rhs.branchingObject_) {
       branchingObject_ = rhs.branchingObject_->clone();
       int numberBranches = branchingObject_->numberBranches();
+      maximumBranches_ = numberBranches;
       changes_ = CoinCopyOfArray(rhs.changes_, numberBranches);
       iterationCounts_ = CoinCopyOfArray(rhs.iterationCounts_, numberBranches);
       statuses_ = CoinCopyOfArray(rhs.statuses_, numberBranches);
@@ -1150,6 +1679,7 @@ OsiHotInfo::operator=(const OsiHotInfo &rhs)
       changes_ = NULL;
       iterationCounts_ = NULL;
       statuses_ = NULL;
+      maximumBranches_ = 0;
     }
   }
   return *this;
@@ -1169,6 +1699,38 @@ OsiHotInfo::clone() const
 {
   return new OsiHotInfo(*this);
 }
+
+// Reset for new candidate reusing storage
+void OsiHotInfo::initialize(OsiSolverInterface *solver,
+  const OsiBranchingInformation *info,
+  const OsiObject *const *objects,
+  int whichObject)
+{
+  originalObjectiveValue_ = info->objectiveValue_;
+  whichObject_ = whichObject;
+  const OsiObject *object = objects[whichObject_];
+  // simple integers can overwrite the old branch - "down" first
+  if (branchingObject_ && typeid(*object) == typeid(OsiSimpleInteger)
+    && typeid(*branchingObject_) == typeid(OsiIntegerBranchingObject)) {
+    static_cast< const OsiSimpleInteger * >(object)->resetBranch(*static_cast< OsiIntegerBranchingObject * >(branchingObject_), solver, info, 0);
+  } else {
+    delete branchingObject_;
+    branchingObject_ = object->createBranch(solver, info, 0);
+  }
+  int numberBranches = branchingObject_->numberBranches();
+  if (numberBranches > maximumBranches_) {
+    delete[] changes_;
+    delete[] iterationCounts_;
+    delete[] statuses_;
+    maximumBranches_ = numberBranches;
+    changes_ = new double[numberBranches];
+    iterationCounts_ = new int[numberBranches];
+    statuses_ = new int[numberBranches];
+  }
+  CoinZeroN(changes_, numberBranches);
+  CoinZeroN(iterationCounts_, numberBranches);
+  CoinFillN(statuses_, numberBranches, -1);
+}
 /* Fill in useful information after strong branch 
  */
 int OsiHotInfo::updateInformation(const OsiSolverInterface *solver, const OsiBranchingInformation *info,
@@ -211,6 +211,49 @@ public:
   }
   /// Set solver and redo arrays
   void setSolver(const OsiSolverInterface *solver);
+  /** Incremental candidate scans.
+
+      In incremental mode #setupList re-evaluates only those objects which
+      reference a column reported through #markChangedColumns since the
+      previous scan; the infeasibility found by the previous scan is reused
+      for the rest.  Objects whose columns are not known (neither a single
+      column object nor an OsiSOS) are always re-evaluated.  The first scan
+      after switching on, after #markAllChanged, after the number of columns
+      or the objects change (see OsiSolverInterface::modelGeneration)
+      evaluates everything.
+  */
+  inline bool incremental() const
+  {
+    return incremental_;
+  }
+  /// Switch incremental candidate scans on or off
+  void setIncremental(bool yesNo);
+  /** Report columns whose value or bounds changed since the last call to
+      #setupList.  Only used in incremental mode.
+  */
+  void markChangedColumns(int numberChanged, const int *which);
+  /// Make the next incremental scan evaluate every object
+  void markAllChanged();
+  /** Bulk scans for simple integers.
+
+      When every object is a plain OsiSimpleInteger and pseudo shadow
+      prices are off, #setupList evaluates all objects in one pass over
+      contiguous arrays of column numbers and priorities, without a virtual
+      call per object, and only calls OsiObject::infeasibility for objects
+      it keeps.  The arrays are rebuilt when the solver's objects change
+      (see OsiSolverInterface::modelGeneration) and the priorities are
+      read again after any OsiObject::setPriority.
+      Incremental mode takes precedence over bulk scans.
+  */
+  inline bool bulkSimpleIntegers() const
+  {
+    return bulkSimpleIntegers_;
+  }
+  /// Switch bulk scans for simple integers on or off (default on)
+  inline void setBulkSimpleIntegers(bool yesNo)
+  {
+    bulkSimpleIntegers_ = yesNo;
+  }
   /** Return status - 
      -1 Node is infeasible
      0  Normal termination - we have a candidate
@@ -231,6 +274,28 @@ public:
     status_ = value;
   }
 
+protected:
+  /** Infeasibility of object \p iObject for the current scan.
+
+      Calls OsiObject::infeasibility unless in incremental mode and the
+      value cached by the previous scan is still valid.
+  */
+  double objectInfeasibility(const OsiBranchingInformation *info,
+    int iObject, int &way);
+  /// Set up the column to object map for incremental scans if needed
+  void prepareIncremental(const OsiBranchingInformation *info);
+  /// Free the data for incremental scans
+  void deleteIncremental();
+  /** Bulk scan of simple integer objects.
+
+      Returns the number of unsatisfied objects, leaving their indices (in
+      increasing order) in scanList_ and their infeasibilities in
+      scanValue_, or -1 if a bulk scan is not possible.
+  */
+  int scanSimpleIntegers(const OsiBranchingInformation *info);
+  /// Free the arrays for bulk scans
+  void deleteSimpleIntegers();
+
 protected:
   // Data
   /// Objective value for feasible solution
@@ -281,6 +346,44 @@ protected:
   bool trustStrongForBound_;
   /// Trust results from strong branching for valid solution
   bool trustStrongForSolution_;
+  /// Incremental candidate scans
+  bool incremental_;
+  /// Number of objects and columns when column to object map was built
+  int mappedObjects_;
+  int mappedColumns_;
+  /// Object array and model generation the column to object map was built for
+  const OsiObject *const *mappedObjectArray_;
+  unsigned int mappedGeneration_;
+  /// Start of objects referencing each column (mappedColumns_+1 entries)
+  int *objectStart_;
+  /// Objects referencing each column
+  int *objectIndex_;
+  /// Infeasibility of each object found by the previous scan
+  double *cachedInfeasibility_;
+  /// Preferred way of each object found by the previous scan
+  int *cachedWay_;
+  /** Per object - 0 cached value valid, 1 re-evaluate on next scan,
+      2 columns not known so always re-evaluate
+  */
+  char *objectChanged_;
+  /// Bulk scans for simple integers allowed
+  bool bulkSimpleIntegers_;
+  /// Object array, count and model generation the simple integer arrays were built for
+  const OsiObject *const *simpleObjects_;
+  int simpleNumber_;
+  unsigned int simpleGeneration_;
+  /// OsiObject::priorityGeneration when simplePriority_ was filled
+  unsigned int simplePriorityGeneration_;
+  /// Column of each object (NULL if not all objects are simple integers)
+  int *simpleColumn_;
+  /// Priority of each object
+  int *simplePriority_;
+  /// Work - infeasibility of each object
+  double *simpleValue_;
+  /// Unsatisfied objects found by bulk scan
+  int *scanList_;
+  /// Infeasibilities of unsatisfied objects found by bulk scan
+  double *scanValue_;
 };
 
 /** This class is the placeholder for the pseudocosts used by OsiChooseStrong.
@@ -372,6 +475,20 @@ public:
        again (after fixing a variable).
 */
 
+/// One remembered strong branching result (see OsiChooseStrong::setStrongCache)
+struct OsiStrongCacheEntry {
+  /// Fingerprint of node bounds
+  CoinUInt64 fingerprint;
+  /// Objective value at node
+  double objectiveValue;
+  /// Down [0] and up [1] objective changes
+  double changes[2];
+  /// Down [0] and up [1] statuses as in OsiHotInfo
+  int statuses[2];
+  /// Object (-1 if entry empty)
+  int whichObject;
+};
+
 class OSILIB_EXPORT OsiChooseStrong : public OsiChooseVariable {
 
 public:
@@ -429,6 +546,26 @@ public:
     shadowPriceMode_ = value;
   }
 
+  /** Remember strong branching results.
+
+      Results are kept in a table of \p size entries keyed by a fingerprint
+      of the node's column bounds and reused for the same candidate while
+      the node's objective is within \p tolerance, so re-solving a node
+      (e.g. after cut rounds which leave bounds alone) does not repeat
+      solveFromHotStart. Zero size switches the cache off.
+  */
+  void setStrongCache(int size, double tolerance = 1.0e-7);
+  /// Number of strong branching candidates answered from the cache
+  inline int numberCacheHits() const
+  {
+    return numberCacheHits_;
+  }
+  /// Number of strong branching candidates not found in the cache
+  inline int numberCacheMisses() const
+  {
+    return numberCacheMisses_;
+  }
+
   /** Accessor method to pseudo cost object*/
   const OsiPseudoCosts &pseudoCosts() const
   {
@@ -473,9 +610,14 @@ protected:
     OsiBranchingInformation *info,
     int numberToDo, int returnCriterion);
 
-  /** Clear out the results array */
+  /** Clear out the results array (kept if big enough) */
   void resetResults(int num);
 
+  /// Fill in result from cache if there, return true if found
+  bool lookupStrongCache(OsiHotInfo &result, const OsiBranchingInformation *info);
+  /// Remember a finished result
+  void storeStrongCache(const OsiHotInfo &result, const OsiBranchingInformation *info);
+
 protected:
   /** Pseudo Shadow Price mode
       0 - off
@@ -492,6 +634,26 @@ protected:
   OsiHotInfo *results_;
   /** The number of OsiHotInfo objetcs that contain information */
   int numResults_;
+  /// Number of OsiHotInfo objects allocated in results_
+  int maximumResults_;
+  /// Bounds saved by doStrongBranching (kept between nodes)
+  double *saveLower_;
+  /// Upper bounds saved by doStrongBranching
+  double *saveUpper_;
+  /// Size of saveLower_ and saveUpper_
+  int sizeSave_;
+  /// Strong branching cache (NULL if off)
+  OsiStrongCacheEntry *cache_;
+  /// Number of entries in cache_
+  int sizeCache_;
+  /// Largest objective difference at which cached results are used
+  double cacheTolerance_;
+  /// Fingerprint of bounds at node being chosen for
+  CoinUInt64 nodeFingerprint_;
+  /// Cache hits
+  int numberCacheHits_;
+  /// Cache misses
+  int numberCacheMisses_;
 };
 
 /** This class contains the result of strong branching on a variable
@@ -522,6 +684,15 @@ public:
   /// Destructor
   virtual ~OsiHotInfo();
 
+  /** Reset for a new candidate, as the constructor from useful information
+      would, but keeping arrays and (for simple integers) the branching
+      object already allocated.
+  */
+  void initialize(OsiSolverInterface *solver,
+    const OsiBranchingInformation *info,
+    const OsiObject *const *objects,
+    int whichObject);
+
   /** Fill in useful information after strong branch.
       Return status
   */
@@ -638,6 +809,8 @@ protected:
   OsiBranchingObject *branchingObject_;
   /// Which object on list
   int whichObject_;
+  /// Number of branches changes_ etc can hold
+  int maximumBranches_;
 };
 
 #endif
@@ -55,4 +55,31 @@
 
 #endif /* HAVE_CONFIG_H */
 
+/* The parallel parts of Osi (e.g., the workers of OsiBranchAndBound) use
+ * C++11 threads.  They are compiled in only if OSI_HAS_THREADS is defined
+ * to 1, which needs a C++11 compiler and linking with the thread library
+ * (e.g., -pthread); otherwise these parts run in the calling thread.
+ * configure --enable-threads does both and records the macro in
+ * config_osi.h, so code using Osi sees the same setting.
+ */
+#ifndef OSI_HAS_THREADS
+#define OSI_HAS_THREADS 0
+#endif
+
+/* The call statistics of OsiSolverInterface (see OsiStatistics.hpp) are
+ * compiled in only if OSI_HAS_STATISTICS is defined to 1; otherwise the
+ * timers in the entry points expand to nothing.
+ */
+#ifndef OSI_HAS_STATISTICS
+#define OSI_HAS_STATISTICS 0
+#endif
+
+/* The trace events of Osi (see OsiTrace.hpp) are recorded only if
+ * OSI_HAS_TRACING is defined to 1; otherwise the trace scopes in the entry
+ * points expand to nothing.
+ */
+#ifndef OSI_HAS_TRACING
+#define OSI_HAS_TRACING 0
+#endif
+
 #endif /*__OSICONFIG_H__*/
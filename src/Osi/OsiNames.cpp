@@ -140,6 +140,74 @@ const OsiSolverInterface::OsiNameVec zeroLengthNameVec(0);
 
 }
 
+/*
+  Name vectors shared between copies of a solver interface. A null data_
+  is an empty vector, so copying a solver without names costs nothing.
+*/
+OsiSolverInterface::OsiSharedNameVec::OsiSharedNameVec(const OsiSharedNameVec &rhs)
+  : data_(rhs.data_)
+{
+  if (data_)
+    data_->count.addReference();
+}
+
+OsiSolverInterface::OsiSharedNameVec &
+OsiSolverInterface::OsiSharedNameVec::operator=(const OsiSharedNameVec &rhs)
+{
+  if (data_ != rhs.data_) {
+    release();
+    data_ = rhs.data_;
+    if (data_)
+      data_->count.addReference();
+  }
+  return *this;
+}
+
+OsiSolverInterface::OsiSharedNameVec &
+OsiSolverInterface::OsiSharedNameVec::operator=(const OsiNameVec &rhs)
+{
+  if (!data_ || &rhs != &data_->names) {
+    if (rhs.empty()) {
+      release();
+    } else {
+      modifiable() = rhs;
+    }
+  }
+  return *this;
+}
+
+OsiSolverInterface::OsiSharedNameVec::~OsiSharedNameVec()
+{
+  release();
+}
+
+const OsiSolverInterface::OsiNameVec &
+OsiSolverInterface::OsiSharedNameVec::emptyNames()
+{
+  return zeroLengthNameVec;
+}
+
+OsiSolverInterface::OsiNameVec &
+OsiSolverInterface::OsiSharedNameVec::modifiable()
+{
+  if (!data_) {
+    data_ = new SharedNames();
+  } else if (data_->count.shared()) {
+    SharedNames *copy = new SharedNames();
+    copy->names = data_->names;
+    release();
+    data_ = copy;
+  }
+  return data_->names;
+}
+
+void OsiSolverInterface::OsiSharedNameVec::release()
+{
+  if (data_ && data_->count.removeReference())
+    delete data_;
+  data_ = NULL;
+}
+
 /*
   Generate the default RNNNNNNN/CNNNNNNN. This is a separate routine so that
   it's available to generate names for new rows and columns. If digits is
@@ -763,7 +831,7 @@ void OsiSolverInterface::setRowColNames(const CoinMpsIO &mps)
     m = mps.getNumRows();
     n = mps.getNumCols();
   }
-  reallocRowColNames(rowNames_, m, colNames_, n);
+  reallocRowColNames(rowNames_.modifiable(), m, colNames_.modifiable(), n);
   /*
   If name discipline is auto, we're done already. Otherwise, load 'em
   up. If I understand MPS correctly, names are required.
@@ -812,7 +880,7 @@ void OsiSolverInterface::setRowColNames(CoinModel &mod)
     m = mod.rowNames()->numberItems();
     n = mod.columnNames()->numberItems();
   }
-  reallocRowColNames(rowNames_, m, colNames_, n);
+  reallocRowColNames(rowNames_.modifiable(), m, colNames_.modifiable(), n);
   /*
   If name discipline is auto, we're done already. Otherwise, load 'em
   up. As best I can see, there's no guarantee that we'll have names for all
@@ -885,7 +953,7 @@ void OsiSolverInterface::setRowColNames(CoinLpIO &mod)
     m = mod.getNumRows();
     n = mod.getNumCols();
   }
-  reallocRowColNames(rowNames_, m, colNames_, n);
+  reallocRowColNames(rowNames_.modifiable(), m, colNames_.modifiable(), n);
   /*
   If name discipline is auto, we're done already. Otherwise, load 'em
   up. I have no idea whether we can guarantee valid names for all rows and
@@ -666,6 +666,7 @@ bool break2(CoinPresolveMatrix *prob)
 
 const CoinPresolveAction *OsiPresolve::presolve(CoinPresolveMatrix *prob)
 {
+  OSI_TRACE_SCOPE("presolve");
   paction_ = 0;
 
   prob->status_ = 0; // say feasible
@@ -823,6 +824,7 @@ const CoinPresolveAction *OsiPresolve::presolve(CoinPresolveMatrix *prob)
     int lastDropped = 0;
     prob->pass_ = 0;
     for (int iLoop = 0; iLoop < numberPasses_; iLoop++) {
+      OSI_TRACE_SCOPE("presolvePass");
 
 #if PRESOLVE_SUMMARY > 0
       std::cout << "Starting major pass " << (iLoop + 1) << std::endl;
@@ -1202,6 +1204,7 @@ const CoinPresolveAction *OsiPresolve::presolve(CoinPresolveMatrix *prob)
 */
 void OsiPresolve::postsolve(CoinPostsolveMatrix &prob)
 {
+  OSI_TRACE_SCOPE("postsolve");
   const CoinPresolveAction *paction = paction_;
 
 #if PRESOLVE_DEBUG > 0
@@ -7,7 +7,9 @@
 #include <cassert>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include "CoinPragma.hpp"
@@ -18,6 +20,205 @@
 
 #include "OsiRowCutDebugger.hpp"
 
+namespace {
+
+/*
+  Reduce a model name to lowercase, considering only the characters between
+  the last '/' and the following '.'.
+*/
+std::string baseModelName(const char *model)
+{
+  std::string modelL;
+  for (int i = 0; i < static_cast< int >(strlen(model)); i++) {
+    char value = static_cast< char >(tolower(model[i]));
+    if (value == '/') {
+      modelL.erase();
+    } else if (value == '.') {
+      break;
+    } else {
+      modelL.append(1, value);
+    }
+  }
+  return modelL;
+}
+
+/*
+  Names in solution files are single tokens. Whitespace is replaced by '_'
+  both when writing and when matching, and an empty name is written as '-'.
+*/
+std::string solutionFileName(const char *model)
+{
+  std::string name = baseModelName(model);
+  for (size_t i = 0; i < name.size(); i++) {
+    if (isspace(static_cast< unsigned char >(name[i])))
+      name[i] = '_';
+  }
+  if (name.empty())
+    name = "-";
+  return name;
+}
+
+/*
+  Known solution files.
+
+  Binary entries start with binaryMagic, followed by (native byte order)
+    int nameLength, char name[nameLength], unsigned int hash,
+    int numberColumns, int full, int numberElements,
+    int indices[numberElements], double values[numberElements]
+
+  Text entries are a header line
+    OsiKnownSolution <name> <hash> <numberColumns> <integer|full> <numberElements>
+  followed by numberElements lines `<index> <value>'. The hash is written in
+  hex; `-' in its place disables the structure check. Lines starting with
+  `#' are ignored.
+
+  Entries list nonzeros only. A `full' entry gives values for all columns;
+  otherwise only integer columns are given and continuous values are
+  recomputed by the debugger.
+*/
+const char binaryMagic[8] = { 'O', 's', 'i', 'K', 'S', 'o', 'l', '1' };
+const char textKeyword[] = "OsiKnownSolution";
+
+struct KnownSolutionEntry {
+  std::string name;
+  bool checkHash;
+  unsigned int hash;
+  int numberColumns;
+  bool full;
+  std::vector< int > indices;
+  std::vector< double > values;
+};
+
+// FNV-1a
+inline void hashBytes(unsigned int &hash, const void *data, size_t length)
+{
+  const unsigned char *bytes = static_cast< const unsigned char * >(data);
+  for (size_t k = 0; k < length; k++) {
+    hash ^= bytes[k];
+    hash *= 16777619u;
+  }
+}
+
+bool entryMatches(const KnownSolutionEntry &entry, int numberColumns,
+  unsigned int hash, const std::string *name)
+{
+  return (entry.numberColumns == numberColumns
+    && (!entry.checkHash || entry.hash == hash)
+    && (name == NULL || entry.name == *name));
+}
+
+/*
+  Number of bytes from the current position to the end of the file, or -1
+  if that cannot be found.
+*/
+long bytesLeft(FILE *fp)
+{
+  long position = ftell(fp);
+  if (position < 0 || fseek(fp, 0, SEEK_END))
+    return -1;
+  long end = ftell(fp);
+  if (fseek(fp, position, SEEK_SET))
+    return -1;
+  return end - position;
+}
+
+/*
+  Read the next binary entry. The coefficients are read only if the entry
+  matches; otherwise they are skipped and \p matched is false. Returns false
+  at end of file or on a malformed entry, including lengths which run past
+  the end of the file (so a corrupt file cannot make us allocate a huge
+  name or coefficient array).
+*/
+bool readBinaryEntry(FILE *fp, KnownSolutionEntry &entry, bool &matched,
+  int numberColumns, unsigned int hash, const std::string *name)
+{
+  char magic[8];
+  int nameLength, full, numberElements;
+  matched = false;
+  if (fread(magic, 1, 8, fp) != 8 || memcmp(magic, binaryMagic, 8))
+    return false;
+  if (fread(&nameLength, sizeof(int), 1, fp) != 1 || nameLength < 0
+    || nameLength > bytesLeft(fp))
+    return false;
+  entry.name.resize(nameLength);
+  if (nameLength && fread(&entry.name[0], 1, nameLength, fp) != static_cast< size_t >(nameLength))
+    return false;
+  if (fread(&entry.hash, sizeof(unsigned int), 1, fp) != 1
+    || fread(&entry.numberColumns, sizeof(int), 1, fp) != 1
+    || fread(&full, sizeof(int), 1, fp) != 1
+    || fread(&numberElements, sizeof(int), 1, fp) != 1
+    || numberElements < 0)
+    return false;
+  entry.checkHash = true;
+  entry.full = (full != 0);
+  if (!entryMatches(entry, numberColumns, hash, name)) {
+    long skip = static_cast< long >(numberElements) * (sizeof(int) + sizeof(double));
+    return (fseek(fp, skip, SEEK_CUR) == 0);
+  }
+  if (static_cast< double >(numberElements) * (sizeof(int) + sizeof(double))
+    > bytesLeft(fp))
+    return false;
+  entry.indices.resize(numberElements);
+  entry.values.resize(numberElements);
+  if (numberElements
+    && (fread(&entry.indices[0], sizeof(int), numberElements, fp) != static_cast< size_t >(numberElements)
+      || fread(&entry.values[0], sizeof(double), numberElements, fp) != static_cast< size_t >(numberElements)))
+    return false;
+  matched = true;
+  return true;
+}
+
+/*
+  Read the next text entry. Returns false at end of file or on a malformed
+  entry.
+*/
+bool readTextEntry(FILE *fp, KnownSolutionEntry &entry, bool &matched,
+  int numberColumns, unsigned int hash, const std::string *name)
+{
+  char word[256];
+  matched = false;
+  // Skip comments up to the next header
+  while (true) {
+    if (fscanf(fp, "%255s", word) != 1)
+      return false;
+    if (word[0] != '#')
+      break;
+    int c;
+    do {
+      c = fgetc(fp);
+    } while (c != '\n' && c != EOF);
+  }
+  if (strcmp(word, textKeyword))
+    return false;
+  char nameWord[256], hashWord[32], typeWord[32];
+  int numberElements;
+  if (fscanf(fp, "%255s %31s %d %31s %d", nameWord, hashWord,
+        &entry.numberColumns, typeWord, &numberElements)
+      != 5
+    || numberElements < 0)
+    return false;
+  entry.name = nameWord;
+  entry.checkHash = strcmp(hashWord, "-") != 0;
+  entry.hash = entry.checkHash
+    ? static_cast< unsigned int >(strtoul(hashWord, NULL, 16)) : 0;
+  entry.full = !strcmp(typeWord, "full");
+  // grow as pairs are read so a bad count cannot allocate a huge array
+  entry.indices.clear();
+  entry.values.clear();
+  for (int k = 0; k < numberElements; k++) {
+    int index;
+    double value;
+    if (fscanf(fp, "%d %lf", &index, &value) != 2)
+      return false;
+    entry.indices.push_back(index);
+    entry.values.push_back(value);
+  }
+  matched = entryMatches(entry, numberColumns, hash, name);
+  return true;
+}
+
+} // end file-local namespace
+
 /*
   Check if any cuts cut off the known solution.
    
@@ -263,17 +464,7 @@ bool OsiRowCutDebugger::activate(const OsiSolverInterface &si,
 
   // Convert input parameter model to be lowercase and
   // only consider characters between '/' and '.'
-  std::string modelL; //name in lowercase
-  for (i = 0; i < static_cast< int >(strlen(model)); i++) {
-    char value = static_cast< char >(tolower(model[i]));
-    if (value == '/') {
-      modelL.erase();
-    } else if (value == '.') {
-      break;
-    } else {
-      modelL.append(1, value);
-    }
-  }
+  std::string modelL = baseModelName(model); //name in lowercase
 
   CoinPackedVector intSoln;
   probType = undefined;
@@ -1508,6 +1699,225 @@ bool OsiRowCutDebugger::activate(const OsiSolverInterface &si,
   return (integerVariable_ != NULL);
 }
 
+/*
+  Fix the integer variables at their known values and solve the lp over the
+  continuous variables. The fixings usually leave the basis of the original
+  problem close to optimal, so start from it when there is one and fall back
+  to a cold solve if that fails.
+*/
+bool OsiRowCutDebugger::solveForContinuous(const OsiSolverInterface &si)
+{
+  OsiSolverInterface *siCopy = si.clone();
+  for (int i = 0; i < numberColumns_; i++) {
+    if (integerVariable_[i]) {
+      double soln = floor(knownSolution_[i] + 0.5);
+      knownSolution_[i] = soln;
+      siCopy->setColBounds(i, soln, soln);
+    }
+  }
+  siCopy->setHintParam(OsiDoScale, false);
+  bool warm = false;
+  CoinWarmStart *ws = si.getWarmStart();
+  const CoinWarmStartBasis *basis = dynamic_cast< const CoinWarmStartBasis * >(ws);
+  if (basis && basis->getNumStructural() == numberColumns_
+    && basis->getNumArtificial() == si.getNumRows()) {
+    warm = siCopy->setWarmStart(basis);
+  }
+  delete ws;
+  if (warm)
+    siCopy->resolve();
+  if (!warm || !siCopy->isProvenOptimal())
+    siCopy->initialSolve();
+  const bool optimal = siCopy->isProvenOptimal();
+  if (optimal) {
+    CoinCopyN(siCopy->getColSolution(), numberColumns_, knownSolution_);
+    knownValue_ = siCopy->getObjValue();
+  }
+  delete siCopy;
+  return optimal;
+}
+
+/*
+  Activate a row cut debugger from a known solution file. See the comments
+  at the head of this file for the formats. Returns true if the debugger is
+  activated.
+*/
+bool OsiRowCutDebugger::activateFromFile(const OsiSolverInterface &si,
+  const char *fileName, const char *model)
+{
+  // set true to get a debug message about activation
+  const bool printActivationNotice = false;
+  //get rid of any arrays
+  delete[] integerVariable_;
+  delete[] knownSolution_;
+  integerVariable_ = NULL;
+  knownSolution_ = NULL;
+  numberColumns_ = 0;
+  knownValue_ = COIN_DBL_MAX;
+
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp) {
+    if (printActivationNotice) {
+      std::cout
+        << "OsiRowCutDebugger::activateFromFile: cannot open "
+        << fileName << "; cannot activate." << std::endl;
+    }
+    return false;
+  }
+  const int nCols = si.getNumCols();
+  const unsigned int hash = structureHash(si);
+  std::string modelL;
+  if (model)
+    modelL = solutionFileName(model);
+  const std::string *name = model ? &modelL : NULL;
+  char magic[8];
+  const bool binary = (fread(magic, 1, 8, fp) == 8 && !memcmp(magic, binaryMagic, 8));
+  rewind(fp);
+
+  KnownSolutionEntry entry;
+  bool matched = false;
+  while (!matched) {
+    bool ok = binary
+      ? readBinaryEntry(fp, entry, matched, nCols, hash, name)
+      : readTextEntry(fp, entry, matched, nCols, hash, name);
+    if (!ok)
+      break;
+  }
+  fclose(fp);
+  if (!matched) {
+    if (printActivationNotice) {
+      std::cout
+        << "OsiRowCutDebugger::activateFromFile: no entry in " << fileName
+        << " matches " << (model ? model : "the problem")
+        << "; cannot activate." << std::endl;
+    }
+    return false;
+  }
+
+  numberColumns_ = nCols;
+  integerVariable_ = new bool[numberColumns_];
+  knownSolution_ = new double[numberColumns_];
+  CoinFillN(knownSolution_, numberColumns_, 0.0);
+  for (int j = 0; j < numberColumns_; j++)
+    integerVariable_[j] = si.isInteger(j);
+  const int numberElements = static_cast< int >(entry.indices.size());
+  for (int k = 0; k < numberElements; k++) {
+    int j = entry.indices[k];
+    if (j >= 0 && j < numberColumns_)
+      knownSolution_[j] = entry.values[k];
+  }
+
+  if (entry.full) {
+    const double *c = si.getObjCoefficients();
+    knownValue_ = 0.0;
+    for (int j = 0; j < numberColumns_; j++) {
+      knownValue_ += c[j] * knownSolution_[j];
+    }
+    knownValue_ = knownValue_ * si.getObjSense();
+  } else if (!solveForContinuous(si)) {
+    if (printActivationNotice) {
+      std::cout
+        << "OsiRowCutDebugger::activateFromFile: solution was not optimal; "
+        << "cannot activate." << std::endl;
+    }
+    delete[] integerVariable_;
+    delete[] knownSolution_;
+    integerVariable_ = NULL;
+    knownSolution_ = NULL;
+    numberColumns_ = 0;
+    knownValue_ = COIN_DBL_MAX;
+  }
+  if (printActivationNotice && integerVariable_) {
+    std::cout
+      << "OsiRowCutDebugger::activateFromFile: activated, z = "
+      << knownValue_ << std::endl;
+  }
+  return (integerVariable_ != NULL);
+}
+
+/*
+  Hash the structure of the problem: dimensions, integrality and the
+  coefficient matrix. Coefficients within a column are combined in an
+  order-independent way, so solvers that store a column in a different
+  order produce the same hash.
+*/
+unsigned int OsiRowCutDebugger::structureHash(const OsiSolverInterface &si)
+{
+  unsigned int hash = 2166136261u;
+  const int nCols = si.getNumCols();
+  const int nRows = si.getNumRows();
+  hashBytes(hash, &nCols, sizeof(int));
+  hashBytes(hash, &nRows, sizeof(int));
+  const CoinPackedMatrix *matrix = si.getMatrixByCol();
+  const CoinBigIndex *start = matrix->getVectorStarts();
+  const int *length = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  for (int j = 0; j < nCols; j++) {
+    unsigned int columnHash = 0;
+    for (CoinBigIndex k = start[j]; k < start[j] + length[j]; k++) {
+      unsigned int elementHash = 2166136261u;
+      hashBytes(elementHash, row + k, sizeof(int));
+      hashBytes(elementHash, element + k, sizeof(double));
+      columnHash += elementHash;
+    }
+    const char integer = si.isInteger(j) ? 1 : 0;
+    hashBytes(hash, &integer, 1);
+    hashBytes(hash, length + j, sizeof(int));
+    hashBytes(hash, &columnHash, sizeof(unsigned int));
+  }
+  return hash;
+}
+
+/*
+  Append the known solution to a solution file. Only nonzeros are written;
+  unless keepContinuous is set, only the integer variables are written.
+*/
+bool OsiRowCutDebugger::writeSolutionFile(const OsiSolverInterface &si,
+  const char *fileName, const char *model, bool binary,
+  bool keepContinuous) const
+{
+  if (!active() || si.getNumCols() != numberColumns_)
+    return false;
+  FILE *fp = fopen(fileName, binary ? "ab" : "a");
+  if (!fp)
+    return false;
+  const std::string name = solutionFileName(model);
+  const unsigned int hash = structureHash(si);
+  std::vector< int > indices;
+  std::vector< double > values;
+  for (int j = 0; j < numberColumns_; j++) {
+    if ((keepContinuous || integerVariable_[j]) && knownSolution_[j]) {
+      indices.push_back(j);
+      values.push_back(knownSolution_[j]);
+    }
+  }
+  const int numberElements = static_cast< int >(indices.size());
+  const int full = keepContinuous ? 1 : 0;
+  if (binary) {
+    const int nameLength = static_cast< int >(name.size());
+    fwrite(binaryMagic, 1, 8, fp);
+    fwrite(&nameLength, sizeof(int), 1, fp);
+    fwrite(name.c_str(), 1, nameLength, fp);
+    fwrite(&hash, sizeof(unsigned int), 1, fp);
+    fwrite(&numberColumns_, sizeof(int), 1, fp);
+    fwrite(&full, sizeof(int), 1, fp);
+    fwrite(&numberElements, sizeof(int), 1, fp);
+    if (numberElements) {
+      fwrite(&indices[0], sizeof(int), numberElements, fp);
+      fwrite(&values[0], sizeof(double), numberElements, fp);
+    }
+  } else {
+    fprintf(fp, "%s %s %x %d %s %d\n", textKeyword, name.c_str(), hash,
+      numberColumns_, full ? "full" : "integer", numberElements);
+    for (int k = 0; k < numberElements; k++)
+      fprintf(fp, "%d %.17g\n", indices[k], values[k]);
+  }
+  const bool ok = !ferror(fp);
+  fclose(fp);
+  return ok;
+}
+
 //-------------------------------------------------------------------
 // Default Constructor
 //-------------------------------------------------------------------
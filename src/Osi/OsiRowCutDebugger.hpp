@@ -25,6 +25,13 @@
   #activate(const OsiSolverInterface&,const char*)
   in OsiRowCutDebugger.cpp for the full set of known problems.
 
+  Known solutions can also be loaded from an external file with
+  #activateFromFile(const OsiSolverInterface&,const char*,const char*).
+  A solution file holds any number of entries, each keyed by a model name
+  and a hash of the problem structure (see #structureHash()), so solutions
+  for models that are not compiled into the debugger can be used without
+  rebuilding. Entries are written with #writeSolutionFile().
+
   A full solution vector can be supplied as a parameter with
   (#activate(const OsiSolverInterface&,const double*,bool)).
   Only the integer values need to be valid.
@@ -101,10 +108,52 @@ public:
   bool activate(const OsiSolverInterface &si, const double *solution,
     bool keepContinuous = false);
 
+  /*! \brief Activate a debugger using a solution read from a file.
+
+    \p fileName may be in the compact binary format or in the sparse text
+    format produced by #writeSolutionFile(); the format is detected from the
+    contents. The first entry whose column count and structure hash match
+    the problem held in \p si is used. If \p model is not NULL, the entry
+    must also carry the same model name (compared as for
+    #activate(const OsiSolverInterface&,const char*)).
+
+    An entry that lists only integer values is completed by a single lp
+    with the integer variables fixed, warm started from the basis held in
+    \p si. An entry that lists all columns is used as given.
+
+    Returns true if the debugger is successfully activated.
+  */
+  bool activateFromFile(const OsiSolverInterface &si, const char *fileName,
+    const char *model = NULL);
+
   /// Returns true if the debugger is active
   bool active() const;
   //@}
 
+  /*! @name Known Solution Files */
+  //@{
+  /*! \brief Hash of the structure of the problem held in the solver.
+
+    Combines the dimensions, the column-major coefficient matrix and the
+    integrality of each column. Bounds, objective and rim vectors are not
+    included, so a solution remains usable after bound tightening.
+  */
+  static unsigned int structureHash(const OsiSolverInterface &si);
+
+  /*! \brief Append the known solution to a solution file.
+
+    Writes an entry keyed by \p model and #structureHash() of \p si. Unless
+    \p keepContinuous is true only the nonzero integer values are written,
+    and the continuous values are recomputed on activation. If \p binary is
+    true the entry is written in the compact binary format, otherwise as
+    sparse text. Entries of both formats should not be mixed in one file.
+
+    Returns true if the entry was written.
+  */
+  bool writeSolutionFile(const OsiSolverInterface &si, const char *fileName,
+    const char *model, bool binary = true, bool keepContinuous = false) const;
+  //@}
+
   /*! @name Query or Manipulate the Known Solution */
   //@{
   /// Return the known solution
@@ -183,6 +232,14 @@ private:
   /// array specifying known solution
   double *knownSolution_;
   //@}
+
+  /*! \brief Fill in the continuous variables of the known solution.
+
+    Fixes the integer variables of a copy of \p si at the values held in
+    knownSolution_ and solves the remaining lp, warm started from the basis
+    of \p si. Returns false if the lp is not proven optimal.
+  */
+  bool solveForContinuous(const OsiSolverInterface &si);
 };
 
 #endif
@@ -4,6 +4,7 @@
 
 #include <stddef.h>
 #include <iostream>
+#include <typeinfo>
 
 #include "CoinPragma.hpp"
 #include "CoinTime.hpp"
@@ -11,6 +12,7 @@
 #include "CoinMpsIO.hpp"
 #include "CoinMessage.hpp"
 #include "CoinWarmStart.hpp"
+#include "CoinWarmStartBasis.hpp"
 #ifdef COIN_SNAPSHOT
 #include "CoinSnapshot.hpp"
 #endif
@@ -30,6 +32,9 @@
 #include "CoinBuild.hpp"
 #include "CoinModel.hpp"
 #include "CoinLpIO.hpp"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 //#############################################################################
 // Hotstart related methods (primarily used in strong branching)
 // It is assumed that only bounds (on vars/constraints) can change between
@@ -44,6 +49,8 @@ void OsiSolverInterface::markHotStart()
 
 void OsiSolverInterface::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
   setWarmStart(ws_);
   resolve();
 }
@@ -90,6 +97,8 @@ CoinBigIndex OsiSolverInterface::getNumElements() const
 
 bool OsiSolverInterface::isBinary(int colIndex) const
 {
+  if (maintainColumnType_)
+    return getColType()[colIndex] == 1;
   if (isContinuous(colIndex))
     return false;
   const double *cu = getColUpper();
@@ -156,6 +165,18 @@ int OsiSolverInterface::getNumIntegers() const
     // work out
     const int numCols = getNumCols();
     int numIntegers = 0;
+    if (maintainColumnType_) {
+      const unsigned int *mask = getColTypeMask();
+      int numberWords = (numCols + 31) >> 5;
+      for (int i = 0; i < numberWords; ++i) {
+        unsigned int word = mask[i];
+        while (word) {
+          word &= word - 1;
+          numIntegers++;
+        }
+      }
+      return numIntegers;
+    }
     for (int i = 0; i < numCols; ++i) {
       if (!isContinuous(i)) {
         numIntegers++;
@@ -167,6 +188,10 @@ int OsiSolverInterface::getNumIntegers() const
 //-----------------------------------------------------------------------------
 bool OsiSolverInterface::isIntegerNonBinary(int colIndex) const
 {
+  if (maintainColumnType_) {
+    char type = getColType()[colIndex];
+    return type == 2 || type == 4;
+  }
   if (isInteger(colIndex) && !isBinary(colIndex))
     return true;
   else
@@ -175,7 +200,7 @@ bool OsiSolverInterface::isIntegerNonBinary(int colIndex) const
 //-----------------------------------------------------------------------------
 bool OsiSolverInterface::isFreeBinary(int colIndex) const
 {
-  if (isContinuous(colIndex))
+  if (maintainColumnType_ ? getColType()[colIndex] != 1 : isContinuous(colIndex))
     return false;
   const double *cu = getColUpper();
   const double *cl = getColLower();
@@ -193,10 +218,19 @@ bool OsiSolverInterface::isFreeBinary(int colIndex) const
 const char *
 OsiSolverInterface::getColType(bool refresh) const
 {
+  const int numCols = getNumCols();
+  if (columnType_ && numberColumnTypes_ != numCols) {
+    // columns added or deleted behind our back
+    delete[] columnType_;
+    columnType_ = NULL;
+  }
   if (!columnType_ || refresh) {
-    const int numCols = getNumCols();
-    if (!columnType_)
+    if (!columnType_) {
       columnType_ = new char[numCols];
+      delete[] columnTypeMask_;
+      columnTypeMask_ = new unsigned int[2 * ((numCols + 31) >> 5)];
+      numberColumnTypes_ = numCols;
+    }
     const double *cu = getColUpper();
     const double *cl = getColLower();
     for (int i = 0; i < numCols; ++i) {
@@ -209,10 +243,151 @@ OsiSolverInterface::getColType(bool refresh) const
         columnType_[i] = 0;
       }
     }
+    CoinZeroN(columnTypeMask_, 2 * ((numCols + 31) >> 5));
+    for (int i = 0; i < numCols; ++i)
+      setColumnTypeBits(i);
+    modelGeneration_++;
   }
   return columnType_;
 }
 
+const unsigned int *
+OsiSolverInterface::getColTypeMask(bool onlyBinary) const
+{
+  getColType();
+  return onlyBinary ? columnTypeMask_ + ((numberColumnTypes_ + 31) >> 5) : columnTypeMask_;
+}
+
+void OsiSolverInterface::setColumnTypeBits(int iColumn) const
+{
+  unsigned int *integerMask = columnTypeMask_;
+  unsigned int *binaryMask = columnTypeMask_ + ((numberColumnTypes_ + 31) >> 5);
+  int iWord = iColumn >> 5;
+  unsigned int bit = 1u << (iColumn & 31);
+  char type = columnType_[iColumn];
+  if (type == 1 || type == 2 || type == 4)
+    integerMask[iWord] |= bit;
+  else
+    integerMask[iWord] &= ~bit;
+  if (type == 1)
+    binaryMask[iWord] |= bit;
+  else
+    binaryMask[iWord] &= ~bit;
+}
+
+void OsiSolverInterface::updateColumnType(int iColumn)
+{
+  if (!columnType_ || iColumn >= numberColumnTypes_)
+    return;
+  char oldType = columnType_[iColumn];
+  if (oldType > 2)
+    return;
+  char type = 0;
+  if (!isContinuous(iColumn)) {
+    double cu = getColUpper()[iColumn];
+    double cl = getColLower()[iColumn];
+    if ((cu == 1 || cu == 0) && (cl == 0 || cl == 1))
+      type = 1;
+    else
+      type = 2;
+  }
+  if (type != oldType) {
+    columnType_[iColumn] = type;
+    setColumnTypeBits(iColumn);
+    modelGeneration_++;
+  }
+}
+
+void OsiSolverInterface::freeColumnTypes()
+{
+  delete[] columnType_;
+  columnType_ = NULL;
+  delete[] columnTypeMask_;
+  columnTypeMask_ = NULL;
+  numberColumnTypes_ = 0;
+  modelGeneration_++;
+}
+
+
+//#############################################################################
+// OsiModelView
+//#############################################################################
+
+OsiModelView::OsiModelView()
+  : solver_(NULL)
+  , generation_(0)
+  , numberRows_(0)
+  , numberColumns_(0)
+  , numberElements_(0)
+  , direction_(1.0)
+  , infinity_(COIN_DBL_MAX)
+  , matrixByCol_(NULL)
+  , matrixByRow_(NULL)
+  , colLower_(NULL)
+  , colUpper_(NULL)
+  , objective_(NULL)
+  , rowLower_(NULL)
+  , rowUpper_(NULL)
+  , colSolution_(NULL)
+  , rowActivity_(NULL)
+  , rowPrice_(NULL)
+  , reducedCost_(NULL)
+  , colType_(NULL)
+{
+}
+
+OsiModelView::OsiModelView(const OsiSolverInterface *solver)
+{
+  refresh(solver);
+}
+
+void OsiModelView::refresh(const OsiSolverInterface *solver)
+{
+  solver_ = solver;
+  numberRows_ = solver->getNumRows();
+  numberColumns_ = solver->getNumCols();
+  numberElements_ = solver->getNumElements();
+  direction_ = solver->getObjSense();
+  infinity_ = solver->getInfinity();
+  matrixByCol_ = solver->getMatrixByCol();
+  matrixByRow_ = solver->getMatrixByRow();
+  colLower_ = solver->getColLower();
+  colUpper_ = solver->getColUpper();
+  objective_ = solver->getObjCoefficients();
+  rowLower_ = solver->getRowLower();
+  rowUpper_ = solver->getRowUpper();
+  colSolution_ = solver->getColSolution();
+  rowActivity_ = solver->getRowActivity();
+  rowPrice_ = solver->getRowPrice();
+  reducedCost_ = solver->getReducedCost();
+  colType_ = solver->getColType(false);
+  // after getColType as that may bump generation
+  generation_ = solver->modelGeneration();
+}
+
+bool OsiModelView::stale() const
+{
+  if (!solver_)
+    return true;
+  const OsiSolverInterface *solver = solver_;
+  return (generation_ != solver->modelGeneration()
+    || numberRows_ != solver->getNumRows()
+    || numberColumns_ != solver->getNumCols()
+    || numberElements_ != solver->getNumElements()
+    || direction_ != solver->getObjSense()
+    || matrixByCol_ != solver->getMatrixByCol()
+    || matrixByRow_ != solver->getMatrixByRow()
+    || colLower_ != solver->getColLower()
+    || colUpper_ != solver->getColUpper()
+    || objective_ != solver->getObjCoefficients()
+    || rowLower_ != solver->getRowLower()
+    || rowUpper_ != solver->getRowUpper()
+    || colSolution_ != solver->getColSolution()
+    || rowActivity_ != solver->getRowActivity()
+    || rowPrice_ != solver->getRowPrice()
+    || reducedCost_ != solver->getReducedCost());
+}
+
 /*
 ###############################################################################
 
@@ -542,6 +717,8 @@ void OsiSolverInterface::addRows(const int numrows, const CoinBigIndex *rowStart
   const int *columns, const double *elements,
   const double *rowlb, const double *rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   double infinity = getInfinity();
   for (int i = 0; i < numrows; ++i) {
     CoinBigIndex start = rowStarts[i];
@@ -556,6 +733,8 @@ void OsiSolverInterface::addRows(const int numrows,
   const CoinPackedVectorBase *const *rows,
   const double *rowlb, const double *rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   for (int i = 0; i < numrows; ++i) {
     addRow(*rows[i], rowlb[i], rowub[i]);
   }
@@ -566,6 +745,8 @@ void OsiSolverInterface::addRows(const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   for (int i = 0; i < numrows; ++i) {
     addRow(*rows[i], rowsen[i], rowrhs[i], rowrng[i]);
   }
@@ -792,14 +973,19 @@ double OsiSolverInterface::getObjValue() const
 // Apply Cuts
 //#############################################################################
 
+
 OsiSolverInterface::ApplyCutsReturnCode
 OsiSolverInterface::applyCuts(const OsiCuts &cs, double effectivenessLb)
 {
+  OSI_STATISTICS_SCOPE(this, ApplyCuts);
+  OSI_TRACE_SCOPE("applyCuts");
   OsiSolverInterface::ApplyCutsReturnCode retVal;
   int i;
+  int numberColCuts = cs.sizeColCuts();
+  int numberRowCuts = cs.sizeRowCuts();
 
   // Loop once for each column cut
-  for (i = 0; i < cs.sizeColCuts(); i++) {
+  for (i = 0; i < numberColCuts; i++) {
     if (cs.colCut(i).effectiveness() < effectivenessLb) {
       retVal.incrementIneffective();
       continue;
@@ -820,48 +1006,82 @@ OsiSolverInterface::applyCuts(const OsiCuts &cs, double effectivenessLb)
     retVal.incrementApplied();
   }
 
-  // Loop once for each row cut
-  for (i = 0; i < cs.sizeRowCuts(); i++) {
-    if (cs.rowCut(i).effectiveness() < effectivenessLb) {
-      retVal.incrementIneffective();
-      continue;
-    }
-    if (!cs.rowCut(i).consistent()) {
-      retVal.incrementInternallyInconsistent();
-      continue;
-    }
-    if (!cs.rowCut(i).consistent(*this)) {
-      retVal.incrementExternallyInconsistent();
-      continue;
-    }
-    if (cs.rowCut(i).infeasible(*this)) {
-      retVal.incrementInfeasible();
-      continue;
+  /*
+    Row cuts. None of the tests depend on rows already added, so screen
+    them all first and pass the survivors to applyRowCuts in one go.
+  */
+  if (numberRowCuts) {
+    reserveCutScratch(numberRowCuts);
+    const OsiRowCut **accepted = cutScratch_;
+    int numberAccepted = 0;
+    for (i = 0; i < numberRowCuts; i++) {
+      const OsiRowCut &cut = cs.rowCut(i);
+      if (cut.effectiveness() < effectivenessLb) {
+        retVal.incrementIneffective();
+        continue;
+      }
+      if (!cut.consistent()) {
+        retVal.incrementInternallyInconsistent();
+        continue;
+      }
+      if (!cut.consistent(*this)) {
+        retVal.incrementExternallyInconsistent();
+        continue;
+      }
+      if (cut.infeasible(*this)) {
+        retVal.incrementInfeasible();
+        continue;
+      }
+      accepted[numberAccepted++] = &cut;
+      retVal.incrementApplied();
     }
-    applyRowCut(cs.rowCut(i));
-    retVal.incrementApplied();
+    if (numberAccepted)
+      applyRowCuts(numberAccepted, accepted);
   }
 
   return retVal;
 }
 /* Apply a collection of row cuts which are all effective.
-   applyCuts seems to do one at a time which seems inefficient.
-   The default does slowly, but solvers can override.
+   The default hands the rows of the cuts to one addRows; solvers can
+   override.
 */
 void OsiSolverInterface::applyRowCuts(int numberCuts, const OsiRowCut *cuts)
 {
-  int i;
-  for (i = 0; i < numberCuts; i++) {
-    applyRowCut(cuts[i]);
-  }
+  if (!numberCuts)
+    return;
+  reserveCutScratch(numberCuts);
+  for (int i = 0; i < numberCuts; i++)
+    cutScratch_[i] = cuts + i;
+  applyRowCuts(numberCuts, cutScratch_);
 }
 // And alternatively
 void OsiSolverInterface::applyRowCuts(int numberCuts, const OsiRowCut **cuts)
 {
-  int i;
-  for (i = 0; i < numberCuts; i++) {
-    applyRowCut(*cuts[i]);
+  if (!numberCuts)
+    return;
+  // cuts may be cutScratch_, which then already holds numberCuts
+  reserveCutScratch(numberCuts);
+  double *rowLower = boundScratch_;
+  double *rowUpper = boundScratch_ + numberCuts;
+  for (int i = 0; i < numberCuts; i++) {
+    rowScratch_[i] = &cuts[i]->row();
+    rowLower[i] = cuts[i]->lb();
+    rowUpper[i] = cuts[i]->ub();
   }
+  addRows(numberCuts, rowScratch_, rowLower, rowUpper);
+}
+// Make the cut scratch space hold at least numberCuts cuts
+void OsiSolverInterface::reserveCutScratch(int numberCuts)
+{
+  if (numberCuts <= sizeCutScratch_)
+    return;
+  delete[] cutScratch_;
+  delete[] rowScratch_;
+  delete[] boundScratch_;
+  sizeCutScratch_ = CoinMax(numberCuts, 2 * sizeCutScratch_);
+  cutScratch_ = new const OsiRowCut *[sizeCutScratch_];
+  rowScratch_ = new const CoinPackedVectorBase *[sizeCutScratch_];
+  boundScratch_ = new double[2 * sizeCutScratch_];
 }
 //#############################################################################
 // Set/Get Application Data
@@ -919,6 +1139,17 @@ void OsiSolverInterface::activateRowCutDebugger(const double *solution,
   rowCutDebugger_ = NULL; // so won't use in new
   rowCutDebugger_ = new OsiRowCutDebugger(*this, solution, keepContinuous);
 }
+/* Activate debugger from a known solution file.
+   The debugger is left inactive if no entry matches this problem.
+*/
+void OsiSolverInterface::activateRowCutDebuggerFromFile(const char *fileName,
+  const char *modelName)
+{
+  delete rowCutDebugger_;
+  rowCutDebugger_ = NULL; // so won't use in new
+  rowCutDebugger_ = new OsiRowCutDebugger();
+  rowCutDebugger_->activateFromFile(*this, fileName, modelName);
+}
 //-------------------------------------------------------------------
 // Get Row Cut Debugger<br>
 // If there is a row cut debugger object associated with
@@ -956,10 +1187,25 @@ OsiSolverInterface::OsiSolverInterface()
   : rowCutDebugger_(NULL)
   , handler_(NULL)
   , defaultHandler_(true)
+  , numberIntegers_(-1)
+  , numberObjects_(0)
+  , object_(NULL)
+  , integerBlock_(NULL)
+  , sizeIntegerBlock_(0)
   , columnType_(NULL)
+  , columnTypeMask_(NULL)
+  , numberColumnTypes_(0)
+  , maintainColumnType_(false)
+  , modelGeneration_(0)
   , appDataEtc_(NULL)
   , ws_(NULL)
   , cgraph_(NULL)
+  , cgraphShare_(NULL)
+  , statistics_(NULL)
+  , sizeCutScratch_(0)
+  , cutScratch_(NULL)
+  , rowScratch_(NULL)
+  , boundScratch_(NULL)
 {
   setInitialData();
 }
@@ -977,8 +1223,7 @@ void OsiSolverInterface::setInitialData()
     handler_ = NULL;
   }
   defaultHandler_ = true;
-  delete[] columnType_;
-  columnType_ = NULL;
+  freeColumnTypes();
   intParam_[OsiMaxNumIteration] = 9999999;
   intParam_[OsiMaxNumIterationHotStart] = 9999999;
   intParam_[OsiNameDiscipline] = 0;
@@ -1002,10 +1247,11 @@ void OsiSolverInterface::setInitialData()
     hintParam_[hint] = false;
     hintStrength_[hint] = OsiHintIgnore;
   }
-  // objects
+  // objects (none yet when constructing; reset() drops any we have)
+  if (object_)
+    releaseObjects();
   numberObjects_ = 0;
   numberIntegers_ = -1;
-  object_ = NULL;
 
   // names
   rowNames_ = OsiNameVec(0);
@@ -1036,27 +1282,30 @@ OsiSolverInterface::OsiSolverInterface(const OsiSolverInterface &rhs)
   CoinDisjointCopyN(rhs.hintParam_, OsiLastHintParam, hintParam_);
   CoinDisjointCopyN(rhs.hintStrength_, OsiLastHintParam, hintStrength_);
   // objects
-  numberObjects_ = rhs.numberObjects_;
-  numberIntegers_ = rhs.numberIntegers_;
-  if (numberObjects_) {
-    object_ = new OsiObject *[numberObjects_];
-    for (int i = 0; i < numberObjects_; i++)
-      object_[i] = rhs.object_[i]->clone();
-  } else {
-    object_ = NULL;
-  }
+  object_ = NULL;
+  integerBlock_ = NULL;
+  sizeIntegerBlock_ = 0;
+  cloneObjects(rhs);
   // names
   rowNames_ = rhs.rowNames_;
   colNames_ = rhs.colNames_;
   objName_ = rhs.objName_;
   // NULL as number of columns not known
   columnType_ = NULL;
-
-  if (rhs.cgraph_) {
-    cgraph_ = cgraph_clone(rhs.cgraph_);
-  } else {
-    cgraph_ = NULL;
-  }
+  columnTypeMask_ = NULL;
+  numberColumnTypes_ = 0;
+  maintainColumnType_ = rhs.maintainColumnType_;
+  modelGeneration_ = rhs.modelGeneration_;
+
+  cgraph_ = NULL;
+  cgraphShare_ = NULL;
+  shareCGraph(rhs);
+  // statistics are per object
+  statistics_ = NULL;
+  sizeCutScratch_ = 0;
+  cutScratch_ = NULL;
+  rowScratch_ = NULL;
+  boundScratch_ = NULL;
 }
 
 //-------------------------------------------------------------------
@@ -1074,14 +1323,15 @@ OsiSolverInterface::~OsiSolverInterface()
     delete handler_;
     handler_ = NULL;
   }
-  for (int i = 0; i < numberObjects_; i++)
-    delete object_[i];
-  delete[] object_;
+  releaseObjects();
   delete[] columnType_;
+  delete[] columnTypeMask_;
 
-  if (cgraph_) {
-    cgraph_free(&cgraph_);
-  }
+  releaseCGraph();
+  delete statistics_;
+  delete[] cutScratch_;
+  delete[] rowScratch_;
+  delete[] boundScratch_;
 }
 
 //----------------------------------------------------------------
@@ -1116,40 +1366,131 @@ OsiSolverInterface::operator=(const OsiSolverInterface &rhs)
       handler_ = rhs.handler_;
     }
     // objects
-    int i;
-    for (i = 0; i < numberObjects_; i++)
-      delete object_[i];
-    delete[] object_;
-    numberObjects_ = rhs.numberObjects_;
-    numberIntegers_ = rhs.numberIntegers_;
-    if (numberObjects_) {
-      object_ = new OsiObject *[numberObjects_];
-      for (i = 0; i < numberObjects_; i++)
-        object_[i] = rhs.object_[i]->clone();
-    } else {
-      object_ = NULL;
-    }
+    releaseObjects();
+    cloneObjects(rhs);
     // names
     rowNames_ = rhs.rowNames_;
     colNames_ = rhs.colNames_;
     objName_ = rhs.objName_;
-    delete[] columnType_;
     // NULL as number of columns not known
-    columnType_ = NULL;
+    freeColumnTypes();
 
-    if (cgraph_) {
-      cgraph_free(&cgraph_);
-    }
-
-    if (rhs.cgraph_) {
-      cgraph_ = cgraph_clone(rhs.cgraph_);
-    } else {
-      cgraph_ = NULL;
-    }
+    releaseCGraph();
+    shareCGraph(rhs);
   }
   return *this;
 }
 
+//-------------------------------------------------------------------
+// Copy on write sharing of objects, names and conflict graph
+//-------------------------------------------------------------------
+void OsiSolverInterface::OsiShareCount::addReference()
+{
+#if defined(__GNUC__)
+  __sync_add_and_fetch(&count_, 1);
+#elif defined(_MSC_VER)
+  _InterlockedIncrement(reinterpret_cast< volatile long * >(&count_));
+#else
+  count_++;
+#endif
+}
+
+bool OsiSolverInterface::OsiShareCount::removeReference()
+{
+#if defined(__GNUC__)
+  return __sync_sub_and_fetch(&count_, 1) == 0;
+#elif defined(_MSC_VER)
+  return _InterlockedDecrement(reinterpret_cast< volatile long * >(&count_)) == 0;
+#else
+  return --count_ == 0;
+#endif
+}
+
+// True if obj is one of the size entries of block
+static bool inBlock(const OsiObject *obj, const OsiSimpleInteger *block, int size)
+{
+  return size && obj >= block && obj < block + size;
+}
+
+void OsiSolverInterface::releaseObjects()
+{
+  for (int i = 0; i < numberObjects_; i++) {
+    if (!inIntegerBlock(object_[i]))
+      delete object_[i];
+  }
+  delete[] object_;
+  delete[] integerBlock_;
+  object_ = NULL;
+  integerBlock_ = NULL;
+  sizeIntegerBlock_ = 0;
+}
+
+/*
+  Objects are always copied, not shared: even const calls such as
+  OsiObject::infeasibility update state in the objects, so copies used in
+  other threads need objects of their own.
+*/
+void OsiSolverInterface::cloneObjects(const OsiSolverInterface &rhs)
+{
+  assert(!object_);
+  numberObjects_ = rhs.numberObjects_;
+  numberIntegers_ = rhs.numberIntegers_;
+  sizeIntegerBlock_ = rhs.sizeIntegerBlock_;
+  if (numberObjects_)
+    copyObjects(rhs.object_, rhs.integerBlock_);
+  else
+    sizeIntegerBlock_ = 0;
+}
+
+// Sets object_ (and integerBlock_) to a private copy of numberObjects_ objects
+void OsiSolverInterface::copyObjects(OsiObject *const *from,
+  const OsiSimpleInteger *fromBlock)
+{
+  object_ = new OsiObject *[numberObjects_];
+  // keep simple integers contiguous in the private copy
+  if (sizeIntegerBlock_) {
+    integerBlock_ = new OsiSimpleInteger[sizeIntegerBlock_];
+    for (int i = 0; i < sizeIntegerBlock_; i++)
+      integerBlock_[i] = fromBlock[i];
+  } else {
+    integerBlock_ = NULL;
+  }
+  for (int i = 0; i < numberObjects_; i++) {
+    const OsiObject *obj = from[i];
+    if (inBlock(obj, fromBlock, sizeIntegerBlock_))
+      object_[i] = integerBlock_ + (static_cast< const OsiSimpleInteger * >(obj) - fromBlock);
+    else
+      object_[i] = obj->clone();
+  }
+}
+
+bool OsiSolverInterface::inIntegerBlock(const OsiObject *obj) const
+{
+  return inBlock(obj, integerBlock_, sizeIntegerBlock_);
+}
+
+void OsiSolverInterface::releaseCGraph()
+{
+  if (cgraph_ && (!cgraphShare_ || cgraphShare_->removeReference())) {
+    cgraph_free(&cgraph_);
+    delete cgraphShare_;
+  }
+  cgraph_ = NULL;
+  cgraphShare_ = NULL;
+}
+
+void OsiSolverInterface::shareCGraph(const OsiSolverInterface &rhs)
+{
+  assert(!cgraph_);
+  if (rhs.cgraph_) {
+    // count made with the graph (see buildCGraph)
+    assert(rhs.cgraphShare_);
+    cgraph_ = rhs.cgraph_;
+    cgraphShare_ = rhs.cgraphShare_;
+    cgraphShare_->addReference();
+  }
+}
+
 //-----------------------------------------------------------------------------
 // Read mps files
 //-----------------------------------------------------------------------------
@@ -1599,6 +1940,27 @@ void OsiSolverInterface::newLanguage(CoinMessages::Language language)
 {
   messages_ = CoinMessage(language);
 }
+// Start or stop collecting call statistics
+void OsiSolverInterface::setStatistics(bool onOff)
+{
+#if OSI_HAS_STATISTICS
+  if (onOff) {
+    if (statistics_)
+      statistics_->clear();
+    else
+      statistics_ = new OsiStatistics();
+  } else {
+    delete statistics_;
+    statistics_ = NULL;
+  }
+#endif
+}
+// Print call statistics
+void OsiSolverInterface::printStatistics() const
+{
+  if (statistics())
+    statistics()->print(handler_, messages_);
+}
 // Is the given primal objective limit reached?
 bool OsiSolverInterface::isPrimalObjectiveLimitReached() const
 {
@@ -1824,6 +2186,73 @@ void OsiSolverInterface::getBInvCol(int, double *) const
   throw CoinError("Needs coding for this interface", "getBInvCol",
     "OsiSolverInterface");
 }
+
+/* Pack nonzeros of dense vector onto end of growing row ordered arrays.
+   Arrays are reallocated as needed.
+*/
+static void packDenseRow(const double *dense, int length, int iRow,
+  CoinBigIndex *start, int *&index, double *&element,
+  CoinBigIndex &numberElements, CoinBigIndex &maximumElements)
+{
+  if (numberElements + length > maximumElements) {
+    maximumElements = CoinMax(2 * maximumElements, numberElements + length);
+    int *tempIndex = new int[maximumElements];
+    double *tempElement = new double[maximumElements];
+    CoinMemcpyN(index, numberElements, tempIndex);
+    CoinMemcpyN(element, numberElements, tempElement);
+    delete[] index;
+    delete[] element;
+    index = tempIndex;
+    element = tempElement;
+  }
+  for (int i = 0; i < length; i++) {
+    if (dense[i]) {
+      index[numberElements] = i;
+      element[numberElements++] = dense[i];
+    }
+  }
+  start[iRow + 1] = numberElements;
+}
+
+// Get several rows of the tableau in sparse form
+void OsiSolverInterface::getBInvARows(int numberWanted, const int *rows,
+  CoinPackedMatrix &abar, CoinPackedMatrix *slack) const
+{
+  int numberColumns = getNumCols();
+  int numberRows = getNumRows();
+  double *z = new double[numberColumns];
+  double *s = slack ? new double[numberRows] : NULL;
+  CoinBigIndex *start = new CoinBigIndex[numberWanted + 1];
+  CoinBigIndex *slackStart = slack ? new CoinBigIndex[numberWanted + 1] : NULL;
+  int *index = NULL;
+  double *element = NULL;
+  int *slackIndex = NULL;
+  double *slackElement = NULL;
+  CoinBigIndex numberElements = 0;
+  CoinBigIndex maximumElements = 0;
+  CoinBigIndex numberSlackElements = 0;
+  CoinBigIndex maximumSlackElements = 0;
+  start[0] = 0;
+  if (slack)
+    slackStart[0] = 0;
+  for (int k = 0; k < numberWanted; k++) {
+    getBInvARow(rows[k], z, s);
+    packDenseRow(z, numberColumns, k, start, index, element,
+      numberElements, maximumElements);
+    if (slack)
+      packDenseRow(s, numberRows, k, slackStart, slackIndex, slackElement,
+        numberSlackElements, maximumSlackElements);
+  }
+  delete[] z;
+  delete[] s;
+  // matrices take over arrays (lengths worked out from starts)
+  int *length = NULL;
+  abar.assignMatrix(false, numberColumns, numberWanted, numberElements,
+    element, index, start, length);
+  if (slack)
+    slack->assignMatrix(false, numberRows, numberWanted, numberSlackElements,
+      slackElement, slackIndex, slackStart, length);
+}
 /* Get warm start information.
    Return warm start information for the current state of the solver
    interface. If there is no valid warm start information, an empty warm
@@ -1839,6 +2268,49 @@ OsiSolverInterface::getPointerToWarmStart(bool &mustDelete)
   return getWarmStart();
 }
 
+/* Get warm start as a diff against reference.
+   Returns NULL if not possible (different types or sizes).
+*/
+CoinWarmStartDiff *
+OsiSolverInterface::getWarmStartDiff(const CoinWarmStart *reference) const
+{
+  if (!reference)
+    return NULL;
+  CoinWarmStart *ws = getWarmStart();
+  if (!ws)
+    return NULL;
+  CoinWarmStartDiff *diff = NULL;
+  const CoinWarmStartBasis *basis = dynamic_cast< const CoinWarmStartBasis * >(ws);
+  const CoinWarmStartBasis *refBasis = dynamic_cast< const CoinWarmStartBasis * >(reference);
+  if (basis && refBasis) {
+    // a basis diff cannot be applied to a basis of another size
+    if (basis->getNumStructural() == refBasis->getNumStructural() && basis->getNumArtificial() == refBasis->getNumArtificial())
+      diff = ws->generateDiff(reference);
+  } else if (!basis && !refBasis) {
+    try {
+      diff = ws->generateDiff(reference);
+    } catch (CoinError &) {
+      diff = NULL;
+    }
+  }
+  delete ws;
+  return diff;
+}
+
+// Set warm start from reference plus diff
+bool OsiSolverInterface::setWarmStartDiff(const CoinWarmStart *reference,
+  const CoinWarmStartDiff *diff)
+{
+  if (!reference)
+    return setWarmStart(NULL);
+  CoinWarmStart *ws = reference->clone();
+  if (diff)
+    ws->applyDiff(diff);
+  bool accepted = setWarmStart(ws);
+  delete ws;
+  return accepted;
+}
+
 /* Get basic indices (order of indices corresponds to the
    order of elements in a vector retured by getBInvACol() and
    getBInvCol()).
@@ -2032,38 +2504,68 @@ void OsiSolverInterface::findIntegers(bool justCount)
   numberIntegers_ = 0;
   int numberColumns = getNumCols();
   int iColumn;
-  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-    if (isInteger(iColumn))
-      numberIntegers_++;
-  }
   if (justCount) {
+    for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (isInteger(iColumn))
+        numberIntegers_++;
+    }
     assert(!numberObjects_);
     assert(!object_);
     return;
   }
+  // one pass over the columns
+  int *integerColumn = new int[numberColumns];
+  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (isInteger(iColumn))
+      integerColumn[numberIntegers_++] = iColumn;
+  }
   int numberIntegers = 0;
   int iObject;
   for (iObject = 0; iObject < numberObjects_; iObject++) {
-    OsiSimpleInteger *obj = dynamic_cast< OsiSimpleInteger * >(object_[iObject]);
-    if (obj)
+    if (inIntegerBlock(object_[iObject]) || dynamic_cast< OsiSimpleInteger * >(object_[iObject]))
       numberIntegers++;
   }
   // if same number return
-  if (numberIntegers_ == numberIntegers)
+  if (numberIntegers_ == numberIntegers) {
+    delete[] integerColumn;
     return;
+  }
   // space for integers
   int *marked = new int[numberColumns];
   for (iColumn = 0; iColumn < numberColumns; iColumn++)
     marked[iColumn] = -1;
-  // mark simple integers
+  /*
+    Mark simple integers. Those in integerBlock_ are marked as -2 - iObject
+    as they move to the new block; others are kept as they are. New simple
+    integers go in the block only if there is one (see compactIntegers).
+  */
+  const bool compact = (integerBlock_ != NULL);
   OsiObject **oldObject = object_;
+  OsiSimpleInteger *oldBlock = integerBlock_;
   int nObjects = numberObjects_;
+  char *isSimple = new char[nObjects];
   for (iObject = 0; iObject < nObjects; iObject++) {
-    OsiSimpleInteger *obj = dynamic_cast< OsiSimpleInteger * >(oldObject[iObject]);
+    OsiSimpleInteger *obj;
+    bool fromBlock = inIntegerBlock(oldObject[iObject]);
+    if (fromBlock)
+      obj = static_cast< OsiSimpleInteger * >(oldObject[iObject]);
+    else
+      obj = dynamic_cast< OsiSimpleInteger * >(oldObject[iObject]);
+    isSimple[iObject] = obj ? 1 : 0;
     if (obj) {
       iColumn = obj->columnNumber();
       assert(iColumn >= 0 && iColumn < numberColumns);
-      marked[iColumn] = iObject;
+      if (fromBlock)
+        marked[iColumn] = -2 - iObject;
+      else
+        marked[iColumn] = iObject;
+    }
+  }
+  int numberInBlock = 0;
+  if (compact) {
+    for (int i = 0; i < numberIntegers_; i++) {
+      if (marked[integerColumn[i]] < 0)
+        numberInBlock++;
     }
   }
   // make a large enough array for new objects
@@ -2073,29 +2575,51 @@ void OsiSolverInterface::findIntegers(bool justCount)
   else
     object_ = NULL;
   /*
-    Walk the variables again, filling in the indices and creating objects for
-    the integer variables. Initially, the objects hold the index and upper &
-    lower bounds.
+    In compact mode new simple integers (and any from the old block) go in
+    one contiguous block rather than one heap allocation each.
   */
+  if (numberInBlock)
+    integerBlock_ = new OsiSimpleInteger[numberInBlock];
+  else
+    integerBlock_ = NULL;
+  sizeIntegerBlock_ = numberInBlock;
+  /*
+    Walk the integer variables, filling in the indices and creating objects.
+    Initially, the objects hold the index and upper & lower bounds.
+  */
+  const double *lower = getColLower();
+  const double *upper = getColUpper();
+  int nInBlock = 0;
   numberObjects_ = 0;
-  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-    if (isInteger(iColumn)) {
-      iObject = marked[iColumn];
-      if (iObject >= 0)
-        object_[numberObjects_++] = oldObject[iObject];
+  for (int i = 0; i < numberIntegers_; i++) {
+    iColumn = integerColumn[i];
+    iObject = marked[iColumn];
+    if (iObject >= 0) {
+      object_[numberObjects_++] = oldObject[iObject];
+    } else if (!compact) {
+      object_[numberObjects_++] = new OsiSimpleInteger(iColumn, lower[iColumn], upper[iColumn]);
+    } else {
+      OsiSimpleInteger &obj = integerBlock_[nInBlock++];
+      if (iObject < -1)
+        obj = *static_cast< OsiSimpleInteger * >(oldObject[-2 - iObject]);
       else
-        object_[numberObjects_++] = new OsiSimpleInteger(this, iColumn);
+        obj = OsiSimpleInteger(iColumn, lower[iColumn], upper[iColumn]);
+      object_[numberObjects_++] = &obj;
     }
   }
+  assert(nInBlock == sizeIntegerBlock_);
   // Now append other objects
   for (iObject = 0; iObject < nObjects; iObject++) {
-    OsiSimpleInteger *obj = dynamic_cast< OsiSimpleInteger * >(oldObject[iObject]);
-    if (!obj)
+    if (!isSimple[iObject])
       object_[numberObjects_++] = oldObject[iObject];
   }
-  // Delete old array (just array)
+  // Delete old arrays (just arrays)
   delete[] oldObject;
+  delete[] oldBlock;
+  delete[] isSimple;
   delete[] marked;
+  delete[] integerColumn;
+  modelGeneration_++;
 }
 /* Identify integer variables and SOS and create corresponding objects.
   
@@ -2114,11 +2638,94 @@ int OsiSolverInterface::findIntegersAndSOS(bool justCount)
 // Delete all object information
 void OsiSolverInterface::deleteObjects()
 {
-  for (int i = 0; i < numberObjects_; i++)
-    delete object_[i];
-  delete[] object_;
-  object_ = NULL;
+  releaseObjects();
   numberObjects_ = 0;
+  modelGeneration_++;
+}
+
+// Delete some objects
+void OsiSolverInterface::deleteObjects(int numberToDelete, const int *which)
+{
+  if (!numberToDelete)
+    return;
+  char *deleted = new char[numberObjects_];
+  CoinZeroN(deleted, numberObjects_);
+  int i;
+  for (i = 0; i < numberToDelete; i++) {
+    int iObject = which[i];
+    if (iObject >= 0 && iObject < numberObjects_)
+      deleted[iObject] = 1;
+  }
+  int n = 0;
+  for (i = 0; i < numberObjects_; i++) {
+    if (deleted[i]) {
+      // entries of integerBlock_ go with the block
+      if (!inIntegerBlock(object_[i]))
+        delete object_[i];
+    } else {
+      object_[n++] = object_[i];
+    }
+  }
+  numberObjects_ = n;
+  delete[] deleted;
+  modelGeneration_++;
+}
+
+// Replace one object
+void OsiSolverInterface::setObject(int which, OsiObject *object)
+{
+  assert(which >= 0 && which < numberObjects_);
+  if (!inIntegerBlock(object_[which]))
+    delete object_[which];
+  object_[which] = object;
+  modelGeneration_++;
+}
+
+// Move simple integers into one contiguous block
+void OsiSolverInterface::compactIntegers()
+{
+  if (!numberObjects_)
+    findIntegers(false);
+  // exactly OsiSimpleInteger, as derived classes would be sliced
+  int numberSimple = 0;
+  int i;
+  for (i = 0; i < numberObjects_; i++) {
+    const OsiObject *obj = object_[i];
+    if (inIntegerBlock(obj) || typeid(*obj) == typeid(OsiSimpleInteger))
+      numberSimple++;
+  }
+  if (numberSimple == sizeIntegerBlock_)
+    return;
+  OsiSimpleInteger *block = new OsiSimpleInteger[numberSimple];
+  int n = 0;
+  for (i = 0; i < numberObjects_; i++) {
+    OsiObject *obj = object_[i];
+    bool fromBlock = inIntegerBlock(obj);
+    if (fromBlock || typeid(*obj) == typeid(OsiSimpleInteger)) {
+      block[n] = *static_cast< OsiSimpleInteger * >(obj);
+      if (!fromBlock)
+        delete obj;
+      object_[i] = block + n++;
+    }
+  }
+  delete[] integerBlock_;
+  integerBlock_ = block;
+  sizeIntegerBlock_ = numberSimple;
+  modelGeneration_++;
+}
+
+// Move simple integers out of integerBlock_
+void OsiSolverInterface::separateObjects()
+{
+  if (!integerBlock_)
+    return;
+  for (int i = 0; i < numberObjects_; i++) {
+    if (inIntegerBlock(object_[i]))
+      object_[i] = new OsiSimpleInteger(*static_cast< OsiSimpleInteger * >(object_[i]));
+  }
+  delete[] integerBlock_;
+  integerBlock_ = NULL;
+  sizeIntegerBlock_ = 0;
 }
 
 /* Add in object information.
@@ -2160,7 +2767,8 @@ void OsiSolverInterface::addObjects(int numberObjects, OsiObject **objects)
         mark[iColumn] = i;
       } else {
         // But delete existing
-        delete object_[i];
+        if (!inIntegerBlock(object_[i]))
+          delete object_[i];
         object_[i] = NULL;
       }
     } else {
@@ -2208,6 +2816,7 @@ void OsiSolverInterface::addObjects(int numberObjects, OsiObject **objects)
   delete[] object_;
   object_ = temp;
   numberObjects_ = newNumberObjects;
+  modelGeneration_++;
 }
 // Deletes branching information before columns deleted
 void OsiSolverInterface::deleteBranchingInfo(int numberDeleted, const int *which)
@@ -2236,7 +2845,13 @@ void OsiSolverInterface::deleteBranchingInfo(int numberDeleted, const int *which
     numberIntegers_ = 0;
     numberObjects_ = 0;
     for (i = 0; i < oldNumberObjects; i++) {
-      OsiSimpleInteger *obj = dynamic_cast< OsiSimpleInteger * >(object_[i]);
+      // entries of integerBlock_ need no RTTI and are freed with the block
+      bool fromBlock = inIntegerBlock(object_[i]);
+      OsiSimpleInteger *obj;
+      if (fromBlock)
+        obj = static_cast< OsiSimpleInteger * >(object_[i]);
+      else
+        obj = dynamic_cast< OsiSimpleInteger * >(object_[i]);
       if (obj) {
         iColumn = obj->columnNumber();
         int jColumn = mark[iColumn];
@@ -2244,7 +2859,7 @@ void OsiSolverInterface::deleteBranchingInfo(int numberDeleted, const int *which
           obj->setColumnNumber(jColumn);
           object_[numberObjects_++] = obj;
           numberIntegers_++;
-        } else {
+        } else if (!fromBlock) {
           delete obj;
         }
       } else {
@@ -2271,6 +2886,7 @@ void OsiSolverInterface::deleteBranchingInfo(int numberDeleted, const int *which
       }
     }
     delete[] mark;
+    modelGeneration_++;
   } else {
     findIntegers(false);
   }
@@ -2292,8 +2908,39 @@ OsiSolverInterface::forceFeasible()
   // Can't guarantee has matrix
   const OsiBranchingInformation info(this, false, false);
   double infeasibility = 0.0;
-  for (i = 0; i < numberObjects_; i++)
-    infeasibility += object_[i]->feasibleRegion(this, &info);
+  /*
+    Simple integers in integerBlock_ are fixed as OsiSimpleInteger::
+    feasibleRegion would, but all in one setColSetBounds call.
+  */
+  int *which = NULL;
+  double *bounds = NULL;
+  int numberFixed = 0;
+  if (sizeIntegerBlock_) {
+    which = new int[sizeIntegerBlock_];
+    bounds = new double[2 * sizeIntegerBlock_];
+    for (i = 0; i < numberObjects_; i++) {
+      if (inIntegerBlock(object_[i])) {
+        int iColumn = static_cast< OsiSimpleInteger * >(object_[i])->columnNumber();
+        double value = info.solution_[iColumn];
+        double newValue = CoinMax(value, info.lower_[iColumn]);
+        newValue = CoinMin(newValue, info.upper_[iColumn]);
+        newValue = floor(newValue + 0.5);
+        which[numberFixed] = iColumn;
+        bounds[2 * numberFixed] = newValue;
+        bounds[2 * numberFixed + 1] = newValue;
+        numberFixed++;
+        infeasibility += fabs(value - newValue);
+      }
+    }
+    if (numberFixed)
+      setColSetBounds(which, which + numberFixed, bounds);
+    delete[] which;
+    delete[] bounds;
+  }
+  for (i = 0; i < numberObjects_; i++) {
+    if (!numberFixed || !inIntegerBlock(object_[i]))
+      infeasibility += object_[i]->feasibleRegion(this, &info);
+  }
   return infeasibility;
 }
 /* 
@@ -2859,11 +3506,12 @@ void OsiSolverInterface::buildCGraph(int minClqRow)
     if (oldSize == cgraphSize) {
       return;
     } else {
-      cgraph_free(&cgraph_);
+      releaseCGraph();
     }
   }
 
   cgraph_ = cgraph_create(cgraphSize);
+  cgraphShare_ = new OsiShareCount();
   const CoinPackedMatrix *matrixByRow = getMatrixByRow();
   const int *idxs = matrixByRow->getIndices();
   const double *coefs = matrixByRow->getElements();
@@ -2872,6 +3520,8 @@ void OsiSolverInterface::buildCGraph(int minClqRow)
   const double *colLB = getColLower();
   const double *colUB = getColUpper();
   const char *colType = getColType();
+  // binary status straight from the maintained mask if we can trust it
+  const unsigned int *binaryMask = maintainColumnType_ ? getColTypeMask(true) : NULL;
   const char *sense = getRowSense();
   const double *rowRHS = getRightHandSide();
   const double *rowRange = getRowRange();
@@ -2881,8 +3531,9 @@ void OsiSolverInterface::buildCGraph(int minClqRow)
 
   for (size_t i = 0; i < numCols; i++) {
     /* inserting trivial conflicts: variable-complement */
-    const bool isBinary = ((colType[i] != 0) && (colLB[i] == 1.0 || colLB[i] == 0.0)
-      && (colUB[i] == 0.0 || colUB[i] == 1.0));
+    const bool isBinary = binaryMask ? ((binaryMask[i >> 5] >> (i & 31)) & 1) != 0
+                                     : ((colType[i] != 0) && (colLB[i] == 1.0 || colLB[i] == 0.0)
+                                         && (colUB[i] == 0.0 || colUB[i] == 1.0));
     if (isBinary) { //consider only binary variables
       cgraph_add_node_conflict(cgraph_, i, i + numCols);
     }
@@ -2913,8 +3564,9 @@ void OsiSolverInterface::buildCGraph(int minClqRow)
     for (size_t j = start[idxRow]; j < start[idxRow] + length[idxRow]; j++) {
       const size_t idxCol = idxs[j];
       const double coefCol = coefs[j] * mult;
-      const bool isBinary = ((colType[idxCol] != 0) && (colLB[idxCol] == 1.0 || colLB[idxCol] == 0.0)
-        && (colUB[idxCol] == 0.0 || colUB[idxCol] == 1.0));
+      const bool isBinary = binaryMask ? ((binaryMask[idxCol >> 5] >> (idxCol & 31)) & 1) != 0
+                                       : ((colType[idxCol] != 0) && (colLB[idxCol] == 1.0 || colLB[idxCol] == 0.0)
+                                           && (colUB[idxCol] == 0.0 || colUB[idxCol] == 1.0));
 
       if (!isBinary) {
         onlyBinaryVars = false;
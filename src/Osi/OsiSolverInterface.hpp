@@ -21,6 +21,8 @@
 #include "OsiConfig.h"
 #include "OsiCollections.hpp"
 #include "OsiSolverParameters.hpp"
+#include "OsiStatistics.hpp"
+#include "OsiTrace.hpp"
 
 class CoinSnapshot;
 class CoinLpIO;
@@ -36,6 +38,7 @@ class CoinModel;
 class OsiSolverBranch;
 class OsiSolverResult;
 class OsiObject;
+class OsiSimpleInteger;
 
 //#############################################################################
 
@@ -72,6 +75,29 @@ class OSILIB_EXPORT OsiSolverInterface  {
 */
 
 public:
+  /** Reference count for data shared between copies of a solver interface.
+
+    Copies share names and the conflict graph until one of them changes
+    them (copy on write). Counts are updated atomically where the compiler
+    allows so copies may be destroyed on different threads.
+  */
+  class OsiShareCount {
+  public:
+    OsiShareCount()
+      : count_(1)
+    {
+    }
+    /// Add a reference
+    void addReference();
+    /// Remove a reference, returns true if that was the last one
+    bool removeReference();
+    /// True if more than one reference
+    inline bool shared() const { return count_ > 1; }
+
+  private:
+    volatile int count_;
+  };
+
   /// Internal class for obtaining status from the applyCuts method
   class ApplyCutsReturnCode {
     friend class OsiSolverInterface;
@@ -486,6 +512,25 @@ public:
       from the underlying solver.
    */
   virtual bool setWarmStart(const CoinWarmStart *warmstart) = 0;
+
+  /** \brief Get warm start information as a difference from a reference.
+
+      Returns the changes that take \p reference to the current warm start
+      (see CoinWarmStart::generateDiff). For a basis only the changed
+      status words are stored, so a tree search can keep one reference
+      (say the root basis) and a small diff per open node instead of a
+      full basis. Returns NULL if the warm start does not support diffs or
+      its size differs from \p reference; use #getWarmStart then.
+    */
+  virtual CoinWarmStartDiff *getWarmStartDiff(const CoinWarmStart *reference) const;
+
+  /** \brief Set warm start information from a reference and a diff.
+
+      Applies \p diff (from #getWarmStartDiff) to a copy of \p reference
+      and passes the result to #setWarmStart, returning its result.
+    */
+  virtual bool setWarmStartDiff(const CoinWarmStart *reference,
+    const CoinWarmStartDiff *diff);
   //@}
 
   //---------------------------------------------------------------------------
@@ -635,6 +680,8 @@ public:
     if (!columnType_)
       getColType(true);
     columnType_[iColumn] = type;
+    setColumnTypeBits(iColumn);
+    modelGeneration_++;
   }
 
   /*! \brief Return an array[getNumCols()] of column types
@@ -652,6 +699,27 @@ public:
     */
   virtual const char *getColType(bool refresh = false) const;
 
+  /** Bit-packed copy of getColType, (getNumCols() + 31) / 32 words.
+
+    Bit i % 32 of word i / 32 is set if column i is integer or, if
+    \p onlyBinary, if its type is 1 (binary).
+  */
+  const unsigned int *getColTypeMask(bool onlyBinary = false) const;
+
+  /** Model generation
+
+    Changes when column types are set or refreshed, when objects are
+    found, added, replaced or deleted, or when markModelChanged is called,
+    so an OsiModelView can tell its type array is out of date and an
+    OsiChooseVariable its column to object map.
+  */
+  inline unsigned int modelGeneration() const { return modelGeneration_; }
+  /** Say model has changed in a way an OsiModelView cannot see from its
+      pointers (e.g. integrality set directly in a derived class, or
+      entries of objects() replaced directly)
+  */
+  inline void markModelChanged() { modelGeneration_++; }
+
   /// Get a pointer to a row-wise copy of the matrix
   virtual const CoinPackedMatrix *getMatrixByRow() const = 0;
 
@@ -933,6 +1001,55 @@ public:
   /*! \brief Data type for name vectors. */
   typedef std::vector< std::string > OsiNameVec;
 
+  /*! \brief Name vector shared between copies of a solver interface.
+
+    Behaves as an OsiNameVec for the operations Osi uses. Const access
+    never copies; non-const access first takes a private copy if the
+    vector is shared.
+  */
+  class OsiSharedNameVec {
+  public:
+    OsiSharedNameVec()
+      : data_(NULL)
+    {
+    }
+    OsiSharedNameVec(const OsiSharedNameVec &rhs);
+    OsiSharedNameVec &operator=(const OsiSharedNameVec &rhs);
+    OsiSharedNameVec &operator=(const OsiNameVec &rhs);
+    ~OsiSharedNameVec();
+
+    /// Names (read only)
+    inline const OsiNameVec &vec() const
+    {
+      return data_ ? data_->names : emptyNames();
+    }
+    inline operator const OsiNameVec &() const { return vec(); }
+    inline size_t size() const { return vec().size(); }
+    inline size_t capacity() const { return vec().capacity(); }
+    inline const std::string &operator[](size_t i) const { return vec()[i]; }
+
+    /// Names for writing (copied first if shared)
+    OsiNameVec &modifiable();
+    inline std::string &operator[](size_t i) { return modifiable()[i]; }
+    inline void resize(size_t n) { modifiable().resize(n); }
+    inline OsiNameVec::iterator begin() { return modifiable().begin(); }
+    inline OsiNameVec::iterator erase(OsiNameVec::iterator first,
+      OsiNameVec::iterator last)
+    {
+      return modifiable().erase(first, last);
+    }
+
+  private:
+    struct SharedNames {
+      OsiShareCount count;
+      OsiNameVec names;
+    };
+    static const OsiNameVec &emptyNames();
+    /// Drop this reference
+    void release();
+    SharedNames *data_;
+  };
+
   /*! \name Methods for row and column names
 
     Osi defines three name management disciplines: `auto names' (0), `lazy
@@ -1330,13 +1447,15 @@ public:
     double effectivenessLb = 0.0);
 
   /** Apply a collection of row cuts which are all effective.
-	applyCuts seems to do one at a time which seems inefficient.
+	The default adds all the cuts with one call of addRows.
 	Would be even more efficient to pass an array of pointers.
     */
   virtual void applyRowCuts(int numberCuts, const OsiRowCut *cuts);
 
   /** Apply a collection of row cuts which are all effective.
-	This is passed in as an array of pointers.
+	This is passed in as an array of pointers. The default passes the
+	rows of the cuts to addRows (the version taking packed vectors and
+	bounds), which the solvers implement in one call.
     */
   virtual void applyRowCuts(int numberCuts, const OsiRowCut **cuts);
 
@@ -1715,6 +1834,21 @@ public:
   }
   //@}
   //---------------------------------------------------------------------------
+  /**@name Call statistics
+
+    Call counts and timers of the main entry points (see OsiStatistics).
+    They are only collected when built with OSI_HAS_STATISTICS (see
+    OsiConfig.h); otherwise these methods do nothing.
+  */
+  //@{
+  /// Start (clearing any earlier counts) or stop collecting call statistics
+  void setStatistics(bool onOff);
+  /// Call statistics (NULL if not collected)
+  inline OsiStatistics *statistics() const { return statistics_; }
+  /// Print call statistics through the message handler
+  void printStatistics() const;
+  //@}
+  //---------------------------------------------------------------------------
   /**@name Methods for dealing with discontinuities other than integers.
   
      Osi should be able to know about SOS and other types.  This is an optional
@@ -1743,13 +1877,28 @@ public:
   virtual int findIntegersAndSOS(bool justCount);
   /// Get the number of objects
   inline int numberObjects() const { return numberObjects_; }
-  /// Set the number of objects
+  /** Set the number of objects.
+
+    Objects past the new number are dropped, not deleted; delete them
+    first as described for objects().
+  */
   inline void setNumberObjects(int number)
   {
     numberObjects_ = number;
+    modelGeneration_++;
   }
 
-  /// Get the array of objects
+  /** Get the array of objects
+
+    Each object is a heap allocation of its own which the solver
+    interface owns, unless compactIntegers has been called: the simple
+    integers then live in one contiguous array and
+    <tt>delete objects()[i]</tt> is wrong for them (setObject,
+    deleteObjects and separateObjects are always safe).
+
+    Copies of this solver interface get copies of the objects, so a copy
+    may evaluate its objects in another thread.
+  */
   inline OsiObject **objects() const { return object_; }
 
   /// Get the specified object
@@ -1760,6 +1909,26 @@ public:
   /// Delete all object information
   void deleteObjects();
 
+  /// Delete the numberToDelete objects in which (the rest move up)
+  void deleteObjects(int numberToDelete, const int *which);
+
+  /// Replace object which by object (taken over; the old one is deleted)
+  void setObject(int which, OsiObject *object);
+
+  /** Keep the OsiSimpleInteger objects (made by findIntegers if there are
+      no objects yet) in one contiguous array, which saves memory and
+      setup time on models with very many integers and gives
+      deleteBranchingInfo and forceFeasible a fast path. Later calls of
+      findIntegers add to the array. Entries of objects() must then not
+      be deleted one by one; see separateObjects.
+  */
+  void compactIntegers();
+
+  /** Undo compactIntegers: give every object a heap allocation of its
+      own, so that entries of objects() may again be deleted one by one.
+  */
+  void separateObjects();
+
   /** Add in object information.
   
       Objects are cloned; the owner can delete the originals.
@@ -1824,6 +1993,17 @@ public:
   virtual void activateRowCutDebugger(const double *solution,
     bool enforceOptimality = true);
 
+  /*! \brief Activate the row cut debugger using a known solution file.
+
+      Activate the debugger for a model not included in the debugger's
+      internal database from a solution file written by
+      OsiRowCutDebugger::writeSolutionFile. The entry is selected by the
+      structure of the problem held in the solver and, if \p modelName is
+      not NULL, by name. See OsiRowCutDebugger::activateFromFile.
+    */
+  virtual void activateRowCutDebuggerFromFile(const char *fileName,
+    const char *modelName = NULL);
+
   /*! \brief Get the row cut debugger provided the solution known to the
     	       debugger is within the feasible region held in the solver.
 
@@ -1970,6 +2150,20 @@ public:
   /*! \brief Get a column of the basis inverse */
   virtual void getBInvCol(int col, double *vec) const;
 
+  /*! \brief Get several rows of the tableau in sparse form
+
+    Row k of \p abar is the tableau row for \p rows[k] (as #getBInvARow),
+    holding only nonzeros; \p abar is row ordered with getNumCols() columns.
+    If \p slack is not NULL it is loaded in the same way with the rows of
+    the basis inverse (getNumRows() columns).
+
+    The default implementation calls #getBInvARow for each row and packs
+    the result. Solvers which can produce sparse rows directly should
+    override it.
+  */
+  virtual void getBInvARows(int numberRows, const int *rows,
+    CoinPackedMatrix &abar, CoinPackedMatrix *slack = NULL) const;
+
   /*! \brief Get indices of basic variables
   
     If the logical (artificial) for row i is basic, the index should be coded
@@ -2103,6 +2297,14 @@ protected:
       default constructor.
     */
   void setInitialData();
+  /** Reclassify one column after its integrality or bounds changed.
+
+      Does nothing if column types are not cached. Types 3 and 4 set by
+      setColumnType are left alone.
+    */
+  void updateColumnType(int iColumn);
+  /// Forget cached column types (columns added, deleted or reloaded)
+  void freeColumnTypes();
   //@}
 
   ///@name Protected member data
@@ -2131,6 +2333,13 @@ protected:
 
   /// Integer and ... information (integer info normally at beginning)
   OsiObject **object_;
+  /** Contiguous storage for the OsiSimpleInteger objects after
+      compactIntegers (else NULL). Entries of object_ which point into it
+      must not be deleted one by one; it goes with object_.
+  */
+  OsiSimpleInteger *integerBlock_;
+  /// Number of entries in integerBlock_
+  int sizeIntegerBlock_;
   /** Column type
       0 - continuous
       1 - binary (may get fixed later)
@@ -2139,6 +2348,17 @@ protected:
       4 - if supported - semi-continuous integer
   */
   mutable char *columnType_;
+  /// Integer then binary bits of columnType_ (see getColTypeMask)
+  mutable unsigned int *columnTypeMask_;
+  /// Number of columns in columnType_
+  mutable int numberColumnTypes_;
+  /** True if the derived class calls updateColumnType and freeColumnTypes
+      whenever integrality, column bounds or the column set change. Then
+      isBinary and friends answer from columnType_.
+  */
+  bool maintainColumnType_;
+  /// Bumped when model changes (see modelGeneration)
+  mutable unsigned int modelGeneration_;
 
   //@}
 
@@ -2166,15 +2386,109 @@ private:
   std::vector< double > strictColSolution_;
 
   /// Row names
-  OsiNameVec rowNames_;
+  OsiSharedNameVec rowNames_;
   /// Column names
-  OsiNameVec colNames_;
+  OsiSharedNameVec colNames_;
   /// Objective name
   std::string objName_;
 
   //@}
 
   CGraph *cgraph_;
+  /// Reference count of cgraph_, made along with the graph
+  OsiShareCount *cgraphShare_;
+  /** Call statistics (NULL if not collected). Always a member, so the
+      layout does not depend on OSI_HAS_STATISTICS. */
+  OsiStatistics *statistics_;
+  /** Scratch space of applyCuts and applyRowCuts (number of cuts it can
+      hold). Kept between calls and not copied. */
+  int sizeCutScratch_;
+  /// Cuts accepted by applyCuts or passed to applyRowCuts
+  const OsiRowCut **cutScratch_;
+  /// Rows of the cuts for addRows
+  const CoinPackedVectorBase **rowScratch_;
+  /// Lower then upper bounds of the cuts (twice sizeCutScratch_)
+  double *boundScratch_;
+
+  /// Make the cut scratch space hold at least numberCuts cuts
+  void reserveCutScratch(int numberCuts);
+  /// Drop this solver's reference to objects
+  void releaseObjects();
+  /// Set objects to copies of those of rhs
+  void cloneObjects(const OsiSolverInterface &rhs);
+  /// Set object_ to a private copy of from (numberObjects_ entries)
+  void copyObjects(OsiObject *const *from, const OsiSimpleInteger *fromBlock);
+  /// True if object lives in integerBlock_
+  bool inIntegerBlock(const OsiObject *obj) const;
+  /// Set bits in columnTypeMask_ from columnType_
+  void setColumnTypeBits(int iColumn) const;
+  /// Drop this solver's reference to conflict graph
+  void releaseCGraph();
+  /// Share conflict graph of rhs
+  void shareCGraph(const OsiSolverInterface &rhs);
+};
+
+//#############################################################################
+/** Read only view of a solver's model and solution.
+
+  Holds pointers to the solver's own arrays, including the cached column
+  and row ordered matrices and column type array, so making or refreshing
+  one copies nothing. Unlike CoinSnapshot the view does not own data; the
+  pointers are good until the model changes or the solver is called
+  again. stale() says when refresh() is needed.
+*/
+class OSILIB_EXPORT OsiModelView {
+public:
+  /// Default constructor - empty view
+  OsiModelView();
+  /// Constructor - view of solver
+  explicit OsiModelView(const OsiSolverInterface *solver);
+
+  /// Point at current data of solver
+  void refresh(const OsiSolverInterface *solver);
+  /** True if view no longer matches solver (generation, sizes or any
+      array has moved). Costs a few virtual calls, no copying.
+  */
+  bool stale() const;
+
+  /// Solver viewed
+  const OsiSolverInterface *solver_;
+  /// Model generation when view made
+  unsigned int generation_;
+  /// Number of rows
+  int numberRows_;
+  /// Number of columns
+  int numberColumns_;
+  /// Number of elements
+  CoinBigIndex numberElements_;
+  /// 1 for minimisation, -1 for maximisation
+  double direction_;
+  /// Value used as infinity
+  double infinity_;
+  /// Column ordered matrix
+  const CoinPackedMatrix *matrixByCol_;
+  /// Row ordered matrix
+  const CoinPackedMatrix *matrixByRow_;
+  /// Column lower bounds
+  const double *colLower_;
+  /// Column upper bounds
+  const double *colUpper_;
+  /// Objective
+  const double *objective_;
+  /// Row lower bounds
+  const double *rowLower_;
+  /// Row upper bounds
+  const double *rowUpper_;
+  /// Column solution
+  const double *colSolution_;
+  /// Row activity
+  const double *rowActivity_;
+  /// Row duals
+  const double *rowPrice_;
+  /// Reduced costs
+  const double *reducedCost_;
+  /// Column types as getColType
+  const char *colType_;
 };
 
 //#############################################################################
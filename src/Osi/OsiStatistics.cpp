@@ -0,0 +1,120 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinMessageHandler.hpp"
+#include "CoinMessage.hpp"
+#include "CoinTime.hpp"
+
+#include "OsiSolverInterface.hpp"
+#include "OsiStatistics.hpp"
+
+//#############################################################################
+// Recording and results
+//#############################################################################
+
+void OsiStatistics::record(Entry entry, double seconds, int iterations)
+{
+  numberCalls_[entry]++;
+  totalTime_[entry] += seconds;
+  if (seconds > maximumTime_[entry])
+    maximumTime_[entry] = seconds;
+  numberIterations_[entry] += iterations;
+}
+
+void OsiStatistics::clear()
+{
+  CoinZeroN(numberCalls_, NumberEntries);
+  CoinZeroN(totalTime_, NumberEntries);
+  CoinZeroN(maximumTime_, NumberEntries);
+  CoinZeroN(numberIterations_, NumberEntries);
+}
+
+const char *OsiStatistics::entryName(Entry entry)
+{
+  static const char *names[NumberEntries] = {
+    "initialSolve",
+    "resolve",
+    "solveFromHotStart",
+    "applyCuts",
+    "addRows",
+    "getWarmStart",
+    "setWarmStart",
+    "getMatrixByRow",
+    "getMatrixByCol"
+  };
+  return names[entry];
+}
+
+void OsiStatistics::print(CoinMessageHandler *handler,
+  const CoinMessages &messages) const
+{
+  char line[200];
+  sprintf(line, "%-18s %10s %12s %12s %12s", "entry", "calls",
+    "total secs", "max secs", "iterations");
+  handler->message(COIN_GENERAL_INFO, messages) << line << CoinMessageEol;
+  for (int i = 0; i < NumberEntries; i++) {
+    if (!numberCalls_[i])
+      continue;
+    sprintf(line, "%-18s %10d %12.6f %12.6f %12.0f",
+      entryName(static_cast< Entry >(i)), numberCalls_[i], totalTime_[i],
+      maximumTime_[i], numberIterations_[i]);
+    handler->message(COIN_GENERAL_INFO, messages) << line << CoinMessageEol;
+  }
+}
+
+//#############################################################################
+// Timer
+//#############################################################################
+
+OsiStatisticsTimer::OsiStatisticsTimer(const OsiSolverInterface *solver,
+  OsiStatistics::Entry entry)
+  : solver_(NULL)
+  , entry_(entry)
+  , startTime_(0.0)
+{
+  OsiStatistics *statistics = solver->statistics();
+  if (statistics && statistics->enter(entry)) {
+    solver_ = solver;
+    startTime_ = CoinGetTimeOfDay();
+  } else if (statistics) {
+    // nested call - just keep depth right
+    solver_ = solver;
+    startTime_ = -1.0;
+  }
+}
+
+OsiStatisticsTimer::~OsiStatisticsTimer()
+{
+  if (!solver_)
+    return;
+  OsiStatistics *statistics = solver_->statistics();
+  if (!statistics)
+    return; // switched off meanwhile
+  statistics->leave(entry_);
+  if (startTime_ < 0.0)
+    return;
+  double seconds = CoinGetTimeOfDay() - startTime_;
+  int iterations = 0;
+  if (entry_ == OsiStatistics::InitialSolve
+    || entry_ == OsiStatistics::Resolve
+    || entry_ == OsiStatistics::SolveFromHotStart)
+    iterations = solver_->getIterationCount();
+  statistics->record(entry_, seconds, iterations);
+}
+
+//#############################################################################
+// Constructors / Destructor
+//#############################################################################
+
+OsiStatistics::OsiStatistics()
+{
+  CoinZeroN(depth_, NumberEntries);
+  clear();
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
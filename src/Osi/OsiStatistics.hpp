@@ -0,0 +1,149 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiStatistics_H
+#define OsiStatistics_H
+
+#include "OsiConfig.h"
+
+class OsiSolverInterface;
+class CoinMessageHandler;
+class CoinMessages;
+
+//#############################################################################
+
+/** Call counts and timers for the main entry points of a solver interface
+
+    An OsiSolverInterface built with OSI_HAS_STATISTICS (see OsiConfig.h)
+    can carry one of these (see OsiSolverInterface::setStatistics). The
+    entry points of the interface and of the solver backends record the
+    number of calls, cumulative and maximum wall clock time and, for the
+    solves, LP iterations. A call made from within a call of the same entry
+    point (say the default addRows calling addRows) is not counted again.
+
+    Without OSI_HAS_STATISTICS the OSI_STATISTICS_SCOPE macro expands to
+    nothing, so there is no cost at all.
+*/
+
+class OSILIB_EXPORT OsiStatistics {
+
+public:
+  /// Entry points recorded
+  enum Entry {
+    InitialSolve = 0,
+    Resolve,
+    SolveFromHotStart,
+    ApplyCuts,
+    AddRows,
+    GetWarmStart,
+    SetWarmStart,
+    GetMatrixByRow,
+    GetMatrixByCol,
+    NumberEntries
+  };
+
+  ///@name Recording
+  //@{
+  /// Records a call of entry taking seconds and iterations LP iterations
+  void record(Entry entry, double seconds, int iterations);
+  /// Notes entering entry; returns false if already inside it
+  inline bool enter(Entry entry)
+  {
+    return depth_[entry]++ == 0;
+  }
+  /// Notes leaving entry
+  inline void leave(Entry entry)
+  {
+    if (depth_[entry] > 0)
+      depth_[entry]--;
+  }
+  /// Zeroes all counts (calls in progress are still recorded)
+  void clear();
+  //@}
+
+  ///@name Results
+  //@{
+  /// Name of entry
+  static const char *entryName(Entry entry);
+  /// Number of calls of entry
+  inline int numberCalls(Entry entry) const
+  {
+    return numberCalls_[entry];
+  }
+  /// Total wall clock time in entry
+  inline double totalTime(Entry entry) const
+  {
+    return totalTime_[entry];
+  }
+  /// Longest call of entry
+  inline double maximumTime(Entry entry) const
+  {
+    return maximumTime_[entry];
+  }
+  /// LP iterations done in entry
+  inline double numberIterations(Entry entry) const
+  {
+    return numberIterations_[entry];
+  }
+  /** Prints a line for each entry called through handler (as
+      COIN_GENERAL_INFO messages) */
+  void print(CoinMessageHandler *handler, const CoinMessages &messages) const;
+  //@}
+
+  ///@name Constructors and destructors
+  //@{
+  /// Default Constructor
+  OsiStatistics();
+  //@}
+
+private:
+  ///@name Private member data
+  //@{
+  /// Number of calls
+  int numberCalls_[NumberEntries];
+  /// Depth of calls (to skip nested calls)
+  int depth_[NumberEntries];
+  /// Total time
+  double totalTime_[NumberEntries];
+  /// Maximum time
+  double maximumTime_[NumberEntries];
+  /// LP iterations (as double as they may add up)
+  double numberIterations_[NumberEntries];
+  //@}
+};
+
+/** Records one call of an entry point of solver from construction to
+    destruction. Does nothing if solver has no statistics. */
+class OSILIB_EXPORT OsiStatisticsTimer {
+public:
+  OsiStatisticsTimer(const OsiSolverInterface *solver, OsiStatistics::Entry entry);
+  ~OsiStatisticsTimer();
+
+private:
+  /// Not copyable
+  OsiStatisticsTimer(const OsiStatisticsTimer &);
+  /// Not assignable
+  OsiStatisticsTimer &operator=(const OsiStatisticsTimer &);
+
+  /// Solver (NULL if not recording)
+  const OsiSolverInterface *solver_;
+  /// Entry point
+  OsiStatistics::Entry entry_;
+  /// Start time
+  double startTime_;
+};
+
+/** Put at the start of an entry point, say
+    OSI_STATISTICS_SCOPE(this, InitialSolve); */
+#if OSI_HAS_STATISTICS
+#define OSI_STATISTICS_SCOPE(solver, entry) \
+  OsiStatisticsTimer osiStatisticsTimer(solver, OsiStatistics::entry)
+#else
+#define OSI_STATISTICS_SCOPE(solver, entry)
+#endif
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,241 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "OsiConfig.h"
+
+#include <cstdio>
+#if OSI_HAS_THREADS
+#include <atomic>
+#include <mutex>
+#endif
+
+#include "CoinTime.hpp"
+
+#include "OsiTrace.hpp"
+
+namespace {
+
+//#############################################################################
+// Per thread ring buffers
+//#############################################################################
+
+/// One begin ('B') or end ('E') event
+struct OsiTraceEvent {
+  const char *name;
+  double time;
+  char phase;
+};
+
+/*
+  Events of one thread.  Only the owning thread writes to it; the number
+  of events is published after the event is complete, so a reader after
+  the threads are done sees complete events.
+*/
+struct OsiTraceBuffer {
+  OsiTraceEvent events[OsiTrace::bufferSize];
+#if OSI_HAS_THREADS
+  std::atomic< unsigned int > numberEvents;
+#else
+  unsigned int numberEvents;
+#endif
+  int threadId;
+  OsiTraceBuffer *next;
+  // next buffer of a finished thread
+  OsiTraceBuffer *nextFree;
+};
+
+/*
+  All buffers ever created (freed at exit). A buffer whose thread has
+  finished goes on the free list and is reused by the next new thread, so
+  there are never more buffers than threads recording at the same time.
+*/
+struct OsiTraceRegistry {
+  OsiTraceBuffer *first;
+  OsiTraceBuffer *firstFree;
+  int numberBuffers;
+  double startTime;
+#if OSI_HAS_THREADS
+  std::mutex mutex;
+  std::atomic< bool > active;
+#else
+  bool active;
+#endif
+  OsiTraceRegistry()
+    : first(NULL)
+    , firstFree(NULL)
+    , numberBuffers(0)
+    , startTime(0.0)
+    , active(false)
+  {
+  }
+  ~OsiTraceRegistry()
+  {
+    while (first) {
+      OsiTraceBuffer *next = first->next;
+      delete first;
+      first = next;
+    }
+  }
+};
+
+OsiTraceRegistry registry;
+
+#if OSI_HAS_THREADS
+// Hands the buffer of a thread back to the free list when the thread ends
+struct OsiTraceBufferHolder {
+  OsiTraceBuffer *buffer;
+  OsiTraceBufferHolder()
+    : buffer(NULL)
+  {
+  }
+  ~OsiTraceBufferHolder()
+  {
+    if (buffer) {
+      std::lock_guard< std::mutex > lock(registry.mutex);
+      buffer->nextFree = registry.firstFree;
+      registry.firstFree = buffer;
+    }
+  }
+};
+
+thread_local OsiTraceBufferHolder threadBuffer;
+#else
+struct OsiTraceBufferHolder {
+  OsiTraceBuffer *buffer;
+};
+
+OsiTraceBufferHolder threadBuffer = { NULL };
+#endif
+
+/*
+  Buffer of this thread, taken on the first event. A reused buffer keeps
+  the events of its previous thread (which came earlier) and its id, so
+  they share a timeline.
+*/
+OsiTraceBuffer *currentBuffer()
+{
+  if (!threadBuffer.buffer) {
+#if OSI_HAS_THREADS
+    std::lock_guard< std::mutex > lock(registry.mutex);
+#endif
+    OsiTraceBuffer *buffer = registry.firstFree;
+    if (buffer) {
+      registry.firstFree = buffer->nextFree;
+    } else {
+      buffer = new OsiTraceBuffer;
+      buffer->numberEvents = 0;
+      buffer->threadId = registry.numberBuffers++;
+      buffer->next = registry.first;
+      registry.first = buffer;
+    }
+    buffer->nextFree = NULL;
+    threadBuffer.buffer = buffer;
+  }
+  return threadBuffer.buffer;
+}
+
+void record(const char *name, char phase)
+{
+  if (!registry.active)
+    return;
+  OsiTraceBuffer *buffer = currentBuffer();
+#if OSI_HAS_THREADS
+  unsigned int n = buffer->numberEvents.load(std::memory_order_relaxed);
+#else
+  unsigned int n = buffer->numberEvents;
+#endif
+  OsiTraceEvent &event = buffer->events[n % OsiTrace::bufferSize];
+  event.name = name;
+  event.time = CoinGetTimeOfDay() - registry.startTime;
+  event.phase = phase;
+#if OSI_HAS_THREADS
+  buffer->numberEvents.store(n + 1, std::memory_order_release);
+#else
+  buffer->numberEvents = n + 1;
+#endif
+}
+
+} // namespace
+
+//#############################################################################
+// Recording
+//#############################################################################
+
+void OsiTrace::start()
+{
+#if OSI_HAS_THREADS
+  std::lock_guard< std::mutex > lock(registry.mutex);
+#endif
+  for (OsiTraceBuffer *buffer = registry.first; buffer; buffer = buffer->next)
+    buffer->numberEvents = 0;
+  registry.startTime = CoinGetTimeOfDay();
+  registry.active = true;
+}
+
+void OsiTrace::stop()
+{
+  registry.active = false;
+}
+
+bool OsiTrace::active()
+{
+  return registry.active;
+}
+
+void OsiTrace::begin(const char *name)
+{
+  record(name, 'B');
+}
+
+void OsiTrace::end(const char *name)
+{
+  record(name, 'E');
+}
+
+//#############################################################################
+// Output
+//#############################################################################
+
+int OsiTrace::writeChromeTrace(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "w");
+  if (!fp)
+    return 1;
+#if OSI_HAS_THREADS
+  std::lock_guard< std::mutex > lock(registry.mutex);
+#endif
+  fprintf(fp, "{\"traceEvents\":[");
+  bool first = true;
+  for (OsiTraceBuffer *buffer = registry.first; buffer; buffer = buffer->next) {
+#if OSI_HAS_THREADS
+    unsigned int n = buffer->numberEvents.load(std::memory_order_acquire);
+#else
+    unsigned int n = buffer->numberEvents;
+#endif
+    unsigned int i = n > static_cast< unsigned int >(bufferSize) ? n - bufferSize : 0;
+    // skip ends whose begin was overwritten (or came before start)
+    int depth = 0;
+    for (; i < n; i++) {
+      const OsiTraceEvent &event = buffer->events[i % bufferSize];
+      if (event.phase == 'E') {
+        if (!depth)
+          continue;
+        depth--;
+      } else {
+        depth++;
+      }
+      fprintf(fp, "%s\n{\"name\":\"%s\",\"cat\":\"osi\",\"ph\":\"%c\","
+                  "\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+        first ? "" : ",", event.name, event.phase, 1.0e6 * event.time,
+        buffer->threadId);
+      first = false;
+    }
+  }
+  fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+  fclose(fp);
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
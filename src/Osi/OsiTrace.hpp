@@ -0,0 +1,98 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiTrace_H
+#define OsiTrace_H
+
+#include "OsiConfig.h"
+
+//#############################################################################
+
+/** Timeline of the calls made in Osi
+
+    Where OsiStatistics adds up the time of each entry point, OsiTrace
+    keeps the individual calls: a begin and an end event, with the time
+    and the thread, for each entry point of the solver interfaces (the
+    same ones as OsiStatistics), OsiChooseStrong::doStrongBranching,
+    OsiPresolve::presolve (and each of its major passes), postsolve and
+    the nodes of OsiBranchAndBound.  writeChromeTrace() writes them in the
+    Chrome trace event format, which chrome://tracing or Perfetto show as
+    one timeline per thread.
+
+    Each thread records into a ring buffer of its own, so recording takes
+    no lock; when a buffer is full the oldest events of that thread are
+    overwritten.  The buffer of a finished thread is reused by the next
+    new thread (its events stay on the same timeline), so memory is
+    bounded by the number of threads tracing at the same time.  start(),
+    stop() and writeChromeTrace() should be called when no other thread is
+    recording (say before and after OsiBranchAndBound::solve).
+
+    The events are only recorded with OSI_HAS_TRACING (see OsiConfig.h);
+    otherwise the OSI_TRACE_SCOPE macro expands to nothing and there is
+    nothing to write.
+*/
+
+class OSILIB_EXPORT OsiTrace {
+
+public:
+  ///@name Recording
+  //@{
+  /// Throws away any events and starts recording
+  static void start();
+  /// Stops recording (the events are kept)
+  static void stop();
+  /// Whether events are being recorded
+  static bool active();
+  /// Records the begin of name (a string which must stay valid)
+  static void begin(const char *name);
+  /// Records the end of name
+  static void end(const char *name);
+  //@}
+
+  ///@name Output
+  //@{
+  /** Writes the events in Chrome trace event format (JSON).
+      Returns 0 if all went well, 1 if the file could not be opened. */
+  static int writeChromeTrace(const char *fileName);
+  //@}
+
+  /// Number of events kept for each thread
+  static const int bufferSize = 32768;
+};
+
+/** Records the begin of name on construction and its end on destruction */
+class OSILIB_EXPORT OsiTraceScope {
+public:
+  explicit OsiTraceScope(const char *name)
+    : name_(name)
+  {
+    OsiTrace::begin(name);
+  }
+  ~OsiTraceScope()
+  {
+    OsiTrace::end(name_);
+  }
+
+private:
+  /// Not copyable
+  OsiTraceScope(const OsiTraceScope &);
+  /// Not assignable
+  OsiTraceScope &operator=(const OsiTraceScope &);
+
+  /// Name of the call
+  const char *name_;
+};
+
+/** Put at the start of a block to be traced, say
+    OSI_TRACE_SCOPE("resolve"); */
+#if OSI_HAS_TRACING
+#define OSI_TRACE_SCOPE(name) OsiTraceScope osiTraceScope(name)
+#else
+#define OSI_TRACE_SCOPE(name)
+#endif
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,572 @@
+/*
+  Copyright (C) 2026
+  All Rights Reserved.
+
+  This code is licensed under the terms of the Eclipse Public License (EPL).
+*/
+
+#include "CoinPragma.hpp"
+
+#include "OsiUnitTests.hpp"
+
+#include "OsiConfig.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#if OSI_HAS_THREADS
+#include <thread>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinFinite.hpp"
+#include "CoinFloatEqual.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiAuxInfo.hpp"
+#include "OsiBranchingObject.hpp"
+#include "OsiChooseVariable.hpp"
+#include "OsiBranchAndBound.hpp"
+
+using namespace OsiUnitTest;
+
+/*
+  Helper methods for the tests of the branching machinery (OsiChooseVariable,
+  OsiBranchAndBound and friends).
+*/
+namespace {
+
+/*
+  Solve p0033 (optimum 3089) with OsiBranchAndBound, once with one worker
+  and once with several. Then check that a search stopped by the node limit
+  says so and still gives a valid bound.
+*/
+void testBranchAndBound(const OsiSolverInterface *emptySi,
+  const std::string &sampleDir)
+{
+  std::string solverName = "Unknown solver";
+  emptySi->getStrParam(OsiSolverName, solverName);
+
+  OsiSolverInterface *si = emptySi->clone();
+  std::string fn = sampleDir + "p0033";
+  OSIUNITTEST_ASSERT_ERROR(si->readMps(fn.c_str(), "mps") == 0, delete si; return, solverName, "branch and bound: read p0033");
+
+  CoinRelFltEq eq(1.0e-7);
+  const double optimum = 3089.0;
+  const int numberColumns = si->getNumCols();
+
+  for (int numberThreads = 1; numberThreads <= 3; numberThreads += 2) {
+    OsiBranchAndBound bab;
+    bab.setNumberThreads(numberThreads);
+    int returnCode = bab.solve(si);
+    OSIUNITTEST_ASSERT_ERROR(returnCode == 0, continue, solverName, "branch and bound: search finishes");
+    OSIUNITTEST_ASSERT_ERROR(bab.hasSolution(), continue, solverName, "branch and bound: solution found");
+    OSIUNITTEST_ASSERT_ERROR(eq(bab.bestObjective(), optimum), {}, solverName, "branch and bound: optimal objective");
+    OSIUNITTEST_ASSERT_ERROR(eq(bab.bestPossible(), optimum), {}, solverName, "branch and bound: best possible equals optimum");
+    // the solution is integer and has the objective value claimed
+    const double *solution = bab.bestSolution();
+    const double *objective = si->getObjCoefficients();
+    double value = 0.0;
+    bool integral = true;
+    for (int i = 0; i < numberColumns; i++) {
+      value += objective[i] * solution[i];
+      if (si->isInteger(i) && fabs(solution[i] - floor(solution[i] + 0.5)) > 1.0e-6)
+        integral = false;
+    }
+    OSIUNITTEST_ASSERT_ERROR(integral, {}, solverName, "branch and bound: solution integral");
+    OSIUNITTEST_ASSERT_ERROR(eq(value, optimum), {}, solverName, "branch and bound: objective of solution");
+
+    // stop after the root
+    OsiBranchAndBound limited;
+    limited.setNumberThreads(numberThreads);
+    limited.setMaximumNodes(1);
+    returnCode = limited.solve(si);
+    double rootValue = si->getObjValue();
+    OSIUNITTEST_ASSERT_ERROR(returnCode == 1, {}, solverName, "branch and bound: node limit");
+    OSIUNITTEST_ASSERT_ERROR(limited.numberNodes() <= 1, {}, solverName, "branch and bound: nodes within limit");
+    OSIUNITTEST_ASSERT_ERROR(limited.bestPossible() <= optimum + 1.0e-6 && limited.bestPossible() >= rootValue - 1.0e-6, {}, solverName, "branch and bound: bound after node limit");
+  }
+
+  delete si;
+}
+
+/*
+  Whether two choosers found the same unsatisfied objects in the same order
+  (and so the same strong branching list)
+*/
+bool sameCandidates(const OsiChooseVariable &one, const OsiChooseVariable &two)
+{
+  if (one.numberUnsatisfied() != two.numberUnsatisfied()
+    || one.numberOnList() != two.numberOnList())
+    return false;
+  for (int i = 0; i < one.numberUnsatisfied(); i++) {
+    if (one.candidates()[i] != two.candidates()[i])
+      return false;
+  }
+  return true;
+}
+
+/*
+  Whether two choosers found the same unsatisfied objects and put objects
+  of the same infeasibility on the strong branching list (ties may be
+  broken differently)
+*/
+bool sameChoice(const OsiChooseVariable &one, const OsiChooseVariable &two,
+  const OsiBranchingInformation *info)
+{
+  int n = one.numberUnsatisfied();
+  if (n != two.numberUnsatisfied() || one.numberOnList() != two.numberOnList())
+    return false;
+  if (n <= 0)
+    return true;
+  std::vector< int > listOne(one.candidates(), one.candidates() + n);
+  std::vector< int > listTwo(two.candidates(), two.candidates() + n);
+  std::sort(listOne.begin(), listOne.end());
+  std::sort(listTwo.begin(), listTwo.end());
+  if (listOne != listTwo)
+    return false;
+  OsiObject **object = info->solver_->objects();
+  std::vector< double > valueOne;
+  std::vector< double > valueTwo;
+  for (int k = 0; k < one.numberOnList(); k++) {
+    int way;
+    valueOne.push_back(object[one.candidates()[k]]->infeasibility(info, way));
+    valueTwo.push_back(object[two.candidates()[k]]->infeasibility(info, way));
+  }
+  std::sort(valueOne.begin(), valueOne.end());
+  std::sort(valueTwo.begin(), valueTwo.end());
+  return valueOne == valueTwo;
+}
+
+/*
+  Bulk scans of simple integers (OsiChooseVariable::setBulkSimpleIntegers)
+  on p0033 must give the candidates of the generic scan, for
+  OsiChooseVariable and OsiChooseStrong, down a few levels of a dive and
+  with two priorities (the second set in place).
+*/
+void testBulkScans(const OsiSolverInterface *emptySi,
+  const std::string &sampleDir)
+{
+  std::string solverName = "Unknown solver";
+  emptySi->getStrParam(OsiSolverName, solverName);
+
+  OsiSolverInterface *si = emptySi->clone();
+  std::string fn = sampleDir + "p0033";
+  OSIUNITTEST_ASSERT_ERROR(si->readMps(fn.c_str(), "mps") == 0, delete si; return, solverName, "bulk scans: read p0033");
+  si->initialSolve();
+  si->findIntegers(false);
+  const int numberColumns = si->getNumCols();
+  std::vector< double > upper(si->getColUpper(), si->getColUpper() + numberColumns);
+
+  OsiChooseVariable bulk(si);
+  bulk.setNumberStrong(5);
+  OsiChooseVariable generic(bulk);
+  generic.setBulkSimpleIntegers(false);
+  OsiChooseStrong strongBulk(si);
+  strongBulk.setNumberStrong(5);
+  OsiChooseStrong strongGeneric(strongBulk);
+  strongGeneric.setBulkSimpleIntegers(false);
+
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass) {
+      /*
+        better priority for every other object, then a fresh dive; no
+        setSolver, the choosers have to see the new priorities themselves
+      */
+      for (int i = 0; i < numberColumns; i++)
+        si->setColUpper(i, upper[i]);
+      si->initialSolve();
+      for (int i = 0; i < si->numberObjects(); i += 2)
+        si->modifiableObject(i)->setPriority(500);
+    }
+    for (int depth = 0; depth < 4; depth++) {
+      OsiBranchingInformation info(si, true, false);
+      bulk.setupList(&info, true);
+      generic.setupList(&info, true);
+      strongBulk.setupList(&info, true);
+      strongGeneric.setupList(&info, true);
+      OSIUNITTEST_ASSERT_ERROR(sameChoice(bulk, generic, &info), {}, solverName, "bulk scans: same candidates as generic scan");
+      OSIUNITTEST_ASSERT_ERROR(sameChoice(strongBulk, strongGeneric, &info), {}, solverName, "bulk scans: same strong candidates as generic scan");
+      if (generic.numberUnsatisfied() <= 0)
+        break;
+      // dive down on the best candidate
+      int iColumn = si->object(generic.candidates()[0])->columnNumber();
+      si->setColUpper(iColumn, floor(si->getColSolution()[iColumn]));
+      si->resolve();
+      if (!si->isProvenOptimal())
+        break;
+    }
+  }
+
+  delete si;
+}
+
+/*
+  Incremental scans (OsiChooseVariable::setIncremental) on p0033 must find
+  what full scans find: at the root, after a bound change whose changed
+  columns are reported, and after an object is replaced in place (which
+  is not reported, the chooser has to see it from the model generation).
+*/
+void testIncrementalScans(const OsiSolverInterface *emptySi,
+  const std::string &sampleDir)
+{
+  std::string solverName = "Unknown solver";
+  emptySi->getStrParam(OsiSolverName, solverName);
+
+  OsiSolverInterface *si = emptySi->clone();
+  std::string fn = sampleDir + "p0033";
+  OSIUNITTEST_ASSERT_ERROR(si->readMps(fn.c_str(), "mps") == 0, delete si; return, solverName, "incremental scans: read p0033");
+  si->initialSolve();
+  si->findIntegers(false);
+  const int numberColumns = si->getNumCols();
+
+  OsiChooseVariable full(si);
+  full.setNumberStrong(5);
+  full.setBulkSimpleIntegers(false);
+  OsiChooseVariable incremental(full);
+  incremental.setIncremental(true);
+  {
+    OsiBranchingInformation info(si, true, false);
+    full.setupList(&info, true);
+    incremental.setupList(&info, true);
+  }
+  OSIUNITTEST_ASSERT_ERROR(full.numberUnsatisfied() > 0, delete si; return, solverName, "incremental scans: root is fractional");
+  OSIUNITTEST_ASSERT_ERROR(sameCandidates(full, incremental), {}, solverName, "incremental scans: same candidates at root");
+
+  // branch down on the best candidate and report what moved
+  int iObject = full.candidates()[0];
+  int iColumn = si->object(iObject)->columnNumber();
+  std::vector< double > before(si->getColSolution(), si->getColSolution() + numberColumns);
+  si->setColUpper(iColumn, floor(before[iColumn]));
+  si->resolve();
+  std::vector< int > changed;
+  const double *solution = si->getColSolution();
+  for (int i = 0; i < numberColumns; i++) {
+    if (solution[i] != before[i] || i == iColumn)
+      changed.push_back(i);
+  }
+  incremental.markChangedColumns(static_cast< int >(changed.size()), &changed[0]);
+  {
+    OsiBranchingInformation info(si, true, false);
+    full.setupList(&info, true);
+    incremental.setupList(&info, true);
+  }
+  OSIUNITTEST_ASSERT_ERROR(sameCandidates(full, incremental), {}, solverName, "incremental scans: same candidates after reported changes");
+
+  // let the object of the best candidate look at an integral column instead
+  if (full.numberUnsatisfied() > 0) {
+    iObject = full.candidates()[0];
+    solution = si->getColSolution();
+    int jColumn = -1;
+    for (int i = 0; i < numberColumns; i++) {
+      if (si->isInteger(i) && fabs(solution[i] - floor(solution[i] + 0.5)) < 1.0e-9) {
+        jColumn = i;
+        break;
+      }
+    }
+    OSIUNITTEST_ASSERT_ERROR(jColumn >= 0, delete si; return, solverName, "incremental scans: integral column");
+    si->setObject(iObject, new OsiSimpleInteger(si, jColumn));
+    {
+      OsiBranchingInformation info(si, true, false);
+      full.setupList(&info, true);
+      incremental.setupList(&info, true);
+    }
+    OSIUNITTEST_ASSERT_ERROR(sameCandidates(full, incremental), {}, solverName, "incremental scans: same candidates after object replaced");
+  }
+
+  delete si;
+}
+
+/*
+  The strong branching cache of OsiChooseStrong on the root of p0033: the
+  first choice misses, choosing again at the same node (objective within
+  the tolerance) hits without any solveFromHotStart, and an objective
+  outside the tolerance misses again.
+*/
+void testStrongCache(const OsiSolverInterface *emptySi,
+  const std::string &sampleDir)
+{
+  std::string solverName = "Unknown solver";
+  emptySi->getStrParam(OsiSolverName, solverName);
+
+  OsiSolverInterface *si = emptySi->clone();
+  std::string fn = sampleDir + "p0033";
+  OSIUNITTEST_ASSERT_ERROR(si->readMps(fn.c_str(), "mps") == 0, delete si; return, solverName, "strong cache: read p0033");
+  si->initialSolve();
+  si->findIntegers(false);
+
+  const double tolerance = 1.0e-4;
+  OsiChooseStrong choose(si);
+  choose.setNumberStrong(3);
+  // never trust pseudo costs, so every candidate is strong branched
+  choose.setNumberBeforeTrusted(1000);
+  choose.setStrongCache(64, tolerance);
+
+  OsiBranchingInformation info(si, true, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.setupList(&info, true) > 0, delete si; return, solverName, "strong cache: root is fractional");
+  choose.chooseVariable(si, &info, false);
+  const int misses = choose.numberCacheMisses();
+  const int strongDone = choose.numberStrongDone();
+  OSIUNITTEST_ASSERT_ERROR(choose.numberCacheHits() == 0 && misses > 0, {}, solverName, "strong cache: first choice misses");
+  OSIUNITTEST_ASSERT_ERROR(strongDone > 0, {}, solverName, "strong cache: first choice strong branches");
+  const int bestObject = choose.bestObjectIndex();
+  const int bestWay = choose.bestWhichWay();
+
+  // same node, objective moved by less than the tolerance
+  OsiBranchingInformation near(si, true, false);
+  near.objectiveValue_ += 0.5 * tolerance;
+  choose.setupList(&near, true);
+  choose.chooseVariable(si, &near, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberCacheHits() > 0, {}, solverName, "strong cache: same node hits");
+  OSIUNITTEST_ASSERT_ERROR(choose.numberCacheHits() + choose.numberCacheMisses() == 2 * misses, {}, solverName, "strong cache: hits and misses add up");
+  OSIUNITTEST_ASSERT_ERROR(choose.numberStrongDone() == 0, {}, solverName, "strong cache: hits skip solveFromHotStart");
+  OSIUNITTEST_ASSERT_ERROR(choose.bestObjectIndex() == bestObject && choose.bestWhichWay() == bestWay, {}, solverName, "strong cache: same choice from cache");
+
+  // objective moved by more than the tolerance
+  const int hits = choose.numberCacheHits();
+  OsiBranchingInformation far(si, true, false);
+  far.objectiveValue_ += 1.0;
+  choose.setupList(&far, true);
+  choose.chooseVariable(si, &far, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberCacheHits() == hits, {}, solverName, "strong cache: no hit outside tolerance");
+  OSIUNITTEST_ASSERT_ERROR(choose.numberStrongDone() > 0, {}, solverName, "strong cache: strong branches outside tolerance");
+
+  // switching the cache off (or on again) clears the counts
+  choose.setStrongCache(0);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberCacheHits() == 0 && choose.numberCacheMisses() == 0, {}, solverName, "strong cache: counts cleared");
+
+  delete si;
+}
+
+/*
+  True if the objects of si are simple integers one after the other in
+  memory (as after compactIntegers).
+*/
+bool contiguousIntegers(const OsiSolverInterface *si)
+{
+  const int numberObjects = si->numberObjects();
+  if (!numberObjects)
+    return false;
+  const OsiSimpleInteger *first = dynamic_cast< const OsiSimpleInteger * >(si->object(0));
+  if (!first)
+    return false;
+  for (int i = 1; i < numberObjects; i++) {
+    if (si->object(i) != first + i)
+      return false;
+  }
+  return true;
+}
+
+/*
+  Object storage on p0033. findIntegers gives each simple integer a heap
+  allocation of its own, so old style code may delete and replace entries.
+  compactIntegers moves them into one array, which copies keep, and
+  separateObjects moves them out again. forceFeasible must fix the same
+  bounds either way.
+*/
+void testCompactIntegers(const OsiSolverInterface *emptySi,
+  const std::string &sampleDir)
+{
+  std::string solverName = "Unknown solver";
+  emptySi->getStrParam(OsiSolverName, solverName);
+
+  OsiSolverInterface *si = emptySi->clone();
+  std::string fn = sampleDir + "p0033";
+  OSIUNITTEST_ASSERT_ERROR(si->readMps(fn.c_str(), "mps") == 0, delete si; return, solverName, "compact integers: read p0033");
+  si->initialSolve();
+  si->findIntegers(false);
+  const int numberObjects = si->numberObjects();
+  const int numberColumns = si->getNumCols();
+  OSIUNITTEST_ASSERT_ERROR(numberObjects > 1, delete si; return, solverName, "compact integers: objects found");
+  std::vector< int > columns(numberObjects);
+  for (int i = 0; i < numberObjects; i++)
+    columns[i] = si->object(i)->columnNumber();
+
+  // old style replacement of an entry
+  OSIUNITTEST_ASSERT_ERROR(!contiguousIntegers(si), {}, solverName, "compact integers: not compact by default");
+  delete si->objects()[0];
+  si->objects()[0] = new OsiSimpleInteger(si, columns[0]);
+
+  si->compactIntegers();
+  OSIUNITTEST_ASSERT_ERROR(si->numberObjects() == numberObjects, {}, solverName, "compact integers: same number of objects");
+  OSIUNITTEST_ASSERT_ERROR(contiguousIntegers(si), {}, solverName, "compact integers: one array");
+  bool sameColumns = true;
+  for (int i = 0; i < numberObjects; i++) {
+    if (si->object(i)->columnNumber() != columns[i])
+      sameColumns = false;
+  }
+  OSIUNITTEST_ASSERT_ERROR(sameColumns, {}, solverName, "compact integers: same columns");
+  // findIntegers again keeps the objects
+  si->findIntegers(false);
+  OSIUNITTEST_ASSERT_ERROR(si->numberObjects() == numberObjects && contiguousIntegers(si), {}, solverName, "compact integers: kept by findIntegers");
+
+  OsiSolverInterface *compact = si->clone();
+  OSIUNITTEST_ASSERT_ERROR(contiguousIntegers(compact), {}, solverName, "compact integers: copies stay compact");
+  // copies have objects of their own (evaluating objects changes them)
+  OSIUNITTEST_ASSERT_ERROR(compact->object(0) != si->object(0), {}, solverName, "compact integers: copies own their objects");
+  const int way = si->object(0)->whichWay();
+  compact->objects()[0]->setWhichWay(1 - way);
+  OSIUNITTEST_ASSERT_ERROR(si->object(0)->whichWay() == way, {}, solverName, "compact integers: copies own their objects");
+
+  si->separateObjects();
+  OSIUNITTEST_ASSERT_ERROR(si->numberObjects() == numberObjects && !contiguousIntegers(si), {}, solverName, "compact integers: separated");
+  delete si->objects()[0];
+  si->objects()[0] = new OsiSimpleInteger(si, columns[0]);
+
+  const double compactInfeasibility = compact->forceFeasible();
+  const double infeasibility = si->forceFeasible();
+  OSIUNITTEST_ASSERT_ERROR(compactInfeasibility == infeasibility, {}, solverName, "compact integers: forceFeasible infeasibility");
+  bool sameBounds = true;
+  for (int j = 0; j < numberColumns; j++) {
+    if (compact->getColLower()[j] != si->getColLower()[j]
+      || compact->getColUpper()[j] != si->getColUpper()[j])
+      sameBounds = false;
+  }
+  OSIUNITTEST_ASSERT_ERROR(sameBounds, {}, solverName, "compact integers: forceFeasible bounds");
+
+  delete compact;
+  delete si;
+}
+
+#if OSI_HAS_THREADS
+/*
+  Offers decreasing values (those of thread k are k modulo numberThreads)
+  and reads the incumbent back after each offer. Every solution value is
+  the objective value, so a torn or freed snapshot shows.
+*/
+void offerAndRead(OsiIncumbent *incumbent, int k, int numberThreads,
+  bool *consistent)
+{
+  const int numberColumns = 20;
+  double solution[numberColumns];
+  double copy[numberColumns];
+  for (int i = 1000; i > 0; i--) {
+    double value = i * numberThreads + k;
+    CoinFillN(solution, numberColumns, value);
+    incumbent->offer(solution, numberColumns, value);
+    double objectiveValue = COIN_DBL_MAX;
+    if (incumbent->solution(objectiveValue, copy, numberColumns)) {
+      for (int j = 0; j < numberColumns; j++) {
+        if (copy[j] != objectiveValue)
+          *consistent = false;
+      }
+    }
+  }
+}
+#endif
+
+/*
+  OsiIncumbent on its own (offer, solution, updateCutoff) and shared by two
+  OsiBabSolver objects on p0033.
+*/
+void testIncumbent(const OsiSolverInterface *emptySi,
+  const std::string &sampleDir)
+{
+  std::string solverName = "Unknown solver";
+  emptySi->getStrParam(OsiSolverName, solverName);
+
+  OsiIncumbent incumbent;
+  double first[3] = { 1.0, 2.0, 3.0 };
+  double second[3] = { 4.0, 5.0, 6.0 };
+  double copy[5];
+  double value = COIN_DBL_MAX;
+  OSIUNITTEST_ASSERT_ERROR(incumbent.objectiveValue() == COIN_DBL_MAX, {}, solverName, "incumbent: none to start with");
+  OSIUNITTEST_ASSERT_ERROR(!incumbent.solution(value, copy, 5), {}, solverName, "incumbent: no solution to start with");
+  OSIUNITTEST_ASSERT_ERROR(incumbent.offer(first, 3, 10.0), {}, solverName, "incumbent: first offer taken");
+  OSIUNITTEST_ASSERT_ERROR(!incumbent.offer(second, 3, 12.0), {}, solverName, "incumbent: worse offer refused");
+  OSIUNITTEST_ASSERT_ERROR(!incumbent.offer(second, 3, 10.0), {}, solverName, "incumbent: equal offer refused");
+  OSIUNITTEST_ASSERT_ERROR(incumbent.offer(second, 3, 5.0), {}, solverName, "incumbent: better offer taken");
+  OSIUNITTEST_ASSERT_ERROR(incumbent.objectiveValue() == 5.0, {}, solverName, "incumbent: objective value");
+  value = COIN_DBL_MAX;
+  bool found = incumbent.solution(value, copy, 5);
+  OSIUNITTEST_ASSERT_ERROR(found && value == 5.0, {}, solverName, "incumbent: solution found");
+  OSIUNITTEST_ASSERT_ERROR(found && copy[0] == 4.0 && copy[1] == 5.0 && copy[2] == 6.0 && copy[3] == 0.0 && copy[4] == 0.0, {}, solverName, "incumbent: solution copied and padded");
+  value = 4.0;
+  OSIUNITTEST_ASSERT_ERROR(!incumbent.solution(value, copy, 5) && value == 4.0, {}, solverName, "incumbent: no solution better than asked");
+
+  OsiBranchingInformation info;
+  info.cutoff_ = 100.0;
+  incumbent.updateCutoff(info);
+  OSIUNITTEST_ASSERT_ERROR(info.cutoff_ == 5.0, {}, solverName, "incumbent: cutoff lowered");
+  info.cutoff_ = 1.0;
+  incumbent.updateCutoff(info);
+  OSIUNITTEST_ASSERT_ERROR(info.cutoff_ == 1.0, {}, solverName, "incumbent: cutoff kept");
+
+  incumbent.clear();
+  value = COIN_DBL_MAX;
+  OSIUNITTEST_ASSERT_ERROR(incumbent.objectiveValue() == COIN_DBL_MAX && !incumbent.solution(value, copy, 5), {}, solverName, "incumbent: cleared");
+
+#if OSI_HAS_THREADS
+  {
+    const int numberThreads = 4;
+    bool consistent = true;
+    std::vector< std::thread > threads;
+    for (int k = 0; k < numberThreads; k++)
+      threads.push_back(std::thread(offerAndRead, &incumbent, k, numberThreads, &consistent));
+    for (int k = 0; k < numberThreads; k++)
+      threads[k].join();
+    OSIUNITTEST_ASSERT_ERROR(consistent, {}, solverName, "incumbent: concurrent readers see whole snapshots");
+    OSIUNITTEST_ASSERT_ERROR(incumbent.objectiveValue() == numberThreads, {}, solverName, "incumbent: concurrent offers keep the best");
+    incumbent.clear();
+  }
+#endif
+
+  // two OsiBabSolver sharing the incumbent
+  OsiSolverInterface *si = emptySi->clone();
+  std::string fn = sampleDir + "p0033";
+  OSIUNITTEST_ASSERT_ERROR(si->readMps(fn.c_str(), "mps") == 0, delete si; return, solverName, "incumbent: read p0033");
+  const int numberColumns = si->getNumCols();
+  std::vector< double > good(numberColumns, 1.0);
+  std::vector< double > worse(numberColumns, 0.0);
+  std::vector< double > solution(numberColumns);
+  OsiBabSolver one;
+  OsiBabSolver two;
+  one.setSolver(si);
+  two.setSolver(si);
+  one.setIncumbent(&incumbent);
+  two.setIncumbent(&incumbent);
+
+  one.setSolution(&good[0], numberColumns, 3200.0);
+  OSIUNITTEST_ASSERT_ERROR(incumbent.objectiveValue() == 3200.0, {}, solverName, "incumbent: OsiBabSolver::setSolution offers");
+  OSIUNITTEST_ASSERT_ERROR(two.incumbent()->objectiveValue() == 3200.0, {}, solverName, "incumbent: other OsiBabSolver sees value");
+  OSIUNITTEST_ASSERT_ERROR(!two.hasSolution(value, &solution[0]), {}, solverName, "incumbent: hasSolution only looks at own solution");
+  found = two.sharedSolution(value, &solution[0]);
+  OSIUNITTEST_ASSERT_ERROR(found && value == 3200.0 && solution == good, {}, solverName, "incumbent: other OsiBabSolver has shared solution");
+
+  two.setSolution(&worse[0], numberColumns, 3300.0);
+  OSIUNITTEST_ASSERT_ERROR(incumbent.objectiveValue() == 3200.0, {}, solverName, "incumbent: worse OsiBabSolver solution not offered");
+  OSIUNITTEST_ASSERT_ERROR(two.bestObjectiveValue() == 3300.0, {}, solverName, "incumbent: own value kept");
+  found = two.hasSolution(value, &solution[0]);
+  OSIUNITTEST_ASSERT_ERROR(found && value == 3300.0 && solution == worse, {}, solverName, "incumbent: hasSolution gives own solution");
+  value = COIN_DBL_MAX;
+  found = two.solution(value, &solution[0], numberColumns) == 1;
+  OSIUNITTEST_ASSERT_ERROR(found && value == 3200.0 && solution == good, {}, solverName, "incumbent: shared solution better than own");
+
+  OsiBabSolver three(two);
+  OSIUNITTEST_ASSERT_ERROR(three.incumbent() == &incumbent, {}, solverName, "incumbent: kept by copy");
+
+  delete si;
+}
+
+} // end file-local namespace
+
+namespace OsiUnitTest {
+
+/*
+  Test the branching machinery with a solver. The solver must give exact
+  LP solutions (not Vol).
+*/
+void testBranching(const OsiSolverInterface *emptySi, const std::string &sampleDir)
+{
+  testingMessage("Testing branching and OsiBranchAndBound.\n");
+  testIncumbent(emptySi, sampleDir);
+  testCompactIntegers(emptySi, sampleDir);
+  testIncrementalScans(emptySi, sampleDir);
+  testStrongCache(emptySi, sampleDir);
+  testBulkScans(emptySi, sampleDir);
+  testBranchAndBound(emptySi, sampleDir);
+}
+
+} // end namespace OsiUnitTest
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
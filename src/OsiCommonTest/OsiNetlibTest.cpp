@@ -26,38 +26,22 @@
 
 #include "OsiSolverInterface.hpp"
 
-/*! \brief Run solvers on NetLib problems.
+#include <iomanip>
+#if OSI_HAS_THREADS
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
 
-  The routine creates a vector of NetLib problems (problem name, objective,
-  various other characteristics), and a vector of solvers to be tested.
-
-  Each solver is run on each problem. The run is deemed successful if the
-  solver reports the correct problem size after loading and returns the
-  correct objective value after optimization.
-
-  If multiple solvers are available, the results are compared pairwise against
-  the results reported by adjacent solvers in the solver vector. Due to
-  limitations of the volume solver, it must be the last solver in vecEmptySiP.
+/*
+  Fill the vectors with the test problem names and characteristics.
 */
-
-void OsiSolverInterfaceMpsUnitTest(const std::vector< OsiSolverInterface * > &vecEmptySiP,
-  const std::string &mpsDir)
-
+static void getNetlibProblems(std::vector< std::string > &mpsName,
+  std::vector< bool > &minObj, std::vector< int > &nRows,
+  std::vector< int > &nCols, std::vector< double > &objValue,
+  std::vector< double > &objValueTol)
 {
-  int i;
-  unsigned int m;
-
-  /*
-  Vectors to hold test problem names and characteristics. The objective value
-  after optimization (objValue) must agree to the specified tolerance
-  (objValueTol).
-*/
-  std::vector< std::string > mpsName;
-  std::vector< bool > minObj;
-  std::vector< int > nRows;
-  std::vector< int > nCols;
-  std::vector< double > objValue;
-  std::vector< double > objValueTol;
 /*
   And a macro to make the vector creation marginally readable.
 */
@@ -172,6 +156,41 @@ void OsiSolverInterfaceMpsUnitTest(const std::vector< OsiSolverInterface * > &ve
   PUSH_MPS("woodw", true, 1099, 8405, 1.3044763331E+00, 1.e-10)
 
 #undef PUSH_MPS
+}
+
+/*! \brief Run solvers on NetLib problems.
+
+  The routine creates a vector of NetLib problems (problem name, objective,
+  various other characteristics), and a vector of solvers to be tested.
+
+  Each solver is run on each problem. The run is deemed successful if the
+  solver reports the correct problem size after loading and returns the
+  correct objective value after optimization.
+
+  If multiple solvers are available, the results are compared pairwise against
+  the results reported by adjacent solvers in the solver vector. Due to
+  limitations of the volume solver, it must be the last solver in vecEmptySiP.
+*/
+
+void OsiSolverInterfaceMpsUnitTest(const std::vector< OsiSolverInterface * > &vecEmptySiP,
+  const std::string &mpsDir)
+
+{
+  int i;
+  unsigned int m;
+
+  /*
+  Vectors to hold test problem names and characteristics. The objective value
+  after optimization (objValue) must agree to the specified tolerance
+  (objValueTol).
+*/
+  std::vector< std::string > mpsName;
+  std::vector< bool > minObj;
+  std::vector< int > nRows;
+  std::vector< int > nCols;
+  std::vector< double > objValue;
+  std::vector< double > objValueTol;
+  getNetlibProblems(mpsName, minObj, nRows, nCols, objValue, objValueTol);
 
   const unsigned int numProblems = static_cast< unsigned int >(mpsName.size());
 
@@ -307,5 +326,334 @@ void OsiSolverInterfaceMpsUnitTest(const std::vector< OsiSolverInterface * > &ve
   }
 }
 
+#if OSI_HAS_THREADS
+namespace {
+
+/*
+  State of a parallel run. Task k is solver k % numSolvers on problem
+  k / numSolvers and comes in two stages: reading the problem and solving
+  it. Once all solvers have read problem m their representations are
+  compared, as in the sequential test, and the solve tasks of m are put at
+  the front of the queue, so problems are finished roughly in order and
+  only a few are loaded at any time. Per task data is only written by the
+  worker running the task.
+*/
+struct NetlibParallelRun {
+  const std::vector< OsiSolverInterface * > *vecEmptySiP;
+  std::string mpsDir;
+  std::vector< std::string > mpsName;
+  std::vector< bool > minObj;
+  std::vector< int > nRows;
+  std::vector< int > nCols;
+  std::vector< double > objValue;
+  std::vector< double > objValueTol;
+  int numSolvers;
+  int numTasks;
+  // tasks ready to run: k reads, numTasks + k solves
+  std::deque< int > queue;
+  // tasks taken from the queue and not yet done
+  int numRunning;
+  // per task: solver, stage (1 read, 2 solved correctly), solve time, output
+  std::vector< OsiSolverInterface * > siP;
+  std::vector< int > siStage;
+  std::vector< double > timeTaken;
+  std::vector< std::string > log;
+  // per problem: tasks of the current stage not yet finished, comparisons
+  std::vector< int > numPending;
+  std::vector< std::string > compareLog;
+  // outcomes of the calling thread
+  OsiUnitTest::TestOutcomes *outcomes;
+  // guards queue, numRunning, numPending, std::cout and outcomes
+  std::mutex mutex;
+  // signalled when a task is queued or done
+  std::condition_variable wakeUp;
+};
+
+/*
+  Stages 0 and 1 of the sequential test (clone and read) for one solver on
+  one problem.
+*/
+void readNetlibTask(NetlibParallelRun &run, int k)
+{
+  const int m = k / run.numSolvers;
+  const int i = k % run.numSolvers;
+  OsiSolverInterface *si = (*run.vecEmptySiP)[i]->clone();
+  run.siP[k] = si;
+
+  std::string fn = run.mpsDir + run.mpsName[m];
+  if (si->readMps(fn.c_str(), "mps") != 0)
+    OSIUNITTEST_ADD_OUTCOME(*si, "netlib " + run.mpsName[m], "reading MPS file failed", OsiUnitTest::TestOutcome::ERROR, false);
+  if (run.minObj[m])
+    si->setObjSense(1.0);
+  else
+    si->setObjSense(-1.0);
+  if (si->getNumRows() != run.nRows[m] - 1 || si->getNumCols() != run.nCols[m]) {
+    OSIUNITTEST_ADD_OUTCOME(*si, "netlib " + run.mpsName[m], "number of rows and columns wrong", OsiUnitTest::TestOutcome::ERROR, false);
+    return;
+  }
+  run.siStage[k] = 1;
+}
+
+/*
+  Called by the worker finishing the last read of problem m. Compares the
+  problem representations of adjacent solvers as the sequential test does,
+  before any of them has solved the problem. Returns the number of solvers
+  which read the problem.
+*/
+int compareNetlibProblem(NetlibParallelRun &run, int m)
+{
+  const int numSolvers = run.numSolvers;
+  OsiSolverInterface **vecSiP = &run.siP[m * numSolvers];
+  const int *siStage = &run.siStage[m * numSolvers];
+  std::ostringstream out;
+
+  int solversReadMpsFile = 0;
+  for (int i = 0; i < numSolvers; i++) {
+    if (siStage[i] >= 1)
+      solversReadMpsFile++;
+  }
+  if (solversReadMpsFile > 0) {
+    // Find an initial pair to compare
+    int s1;
+    for (s1 = 0; s1 < numSolvers - 1 && siStage[s1] < 1; s1++)
+      ;
+    int s2;
+    for (s2 = s1 + 1; s2 < numSolvers && siStage[s2] < 1; s2++)
+      ;
+    while (s2 < numSolvers) {
+      std::string name1, name2;
+      vecSiP[s1]->getStrParam(OsiSolverName, name1);
+      vecSiP[s2]->getStrParam(OsiSolverName, name2);
+      out << "  comparing problem representation for " << name1 << " and " << name2 << " ...";
+      if (OsiUnitTest::compareProblems(vecSiP[s1], vecSiP[s2]))
+        out << " ok.";
+      out << std::endl;
+      s1 = s2;
+      for (s2++; s2 < numSolvers && siStage[s2] < 1; s2++)
+        ;
+    }
+  }
+  run.compareLog[m] = out.str();
+  return solversReadMpsFile;
+}
+
+/*
+  Stage 2 of the sequential test (solve) for one solver on one problem it
+  has read. Output is kept for finishNetlibProblem.
+*/
+void solveNetlibTask(NetlibParallelRun &run, int k)
+{
+  const int m = k / run.numSolvers;
+  std::ostringstream out;
+  OsiSolverInterface *si = run.siP[k];
+  std::string siName;
+  si->getStrParam(OsiSolverName, siName);
+
+  double startTime = CoinWallclockTime();
+  OSIUNITTEST_CATCH_ERROR(si->initialSolve(), return, *si, "netlib " + run.mpsName[m]);
+
+  double timeOfSolution = CoinWallclockTime() - startTime;
+  OSIUNITTEST_ASSERT_ERROR(si->isProvenOptimal(), {}, *si, "netlib " + run.mpsName[m]);
+  if (si->isProvenOptimal()) {
+    double soln = si->getObjValue();
+    CoinRelFltEq eq(run.objValueTol[m]);
+    OSIUNITTEST_ASSERT_ERROR(eq(soln, run.objValue[m]),
+      std::cerr << soln << " != " << run.objValue[m] << "; error = " << fabs(run.objValue[m] - soln),
+      *si, "netlib " + run.mpsName[m]);
+    if (eq(soln, run.objValue[m])) {
+      out << "  " << siName << " " << soln << " = " << run.objValue[m] << ", " << si->getIterationCount() << " iters; okay";
+      run.siStage[k] = 2;
+    }
+    out << " - took " << timeOfSolution << " seconds." << std::endl;
+    run.timeTaken[k] = timeOfSolution;
+  } else {
+    out << "  " << siName << "; error ";
+    if (si->isProvenPrimalInfeasible())
+      out << "primal infeasible";
+    else if (si->isIterationLimitReached())
+      out << "iteration limit";
+    else if (si->isAbandoned())
+      out << "abandoned";
+    else
+      out << "unknown";
+    out << std::endl;
+  }
+  run.log[k] = out.str();
+}
+
+/*
+  Called by the worker finishing the last task of problem m. Prints the
+  output for the problem and deletes the solvers.
+*/
+void finishNetlibProblem(NetlibParallelRun &run, int m)
+{
+  const int numSolvers = run.numSolvers;
+  OsiSolverInterface **vecSiP = &run.siP[m * numSolvers];
+  std::ostringstream out;
+  out << "  processing mps file: " << run.mpsName[m]
+      << " (" << m + 1 << " out of " << run.mpsName.size() << ")" << std::endl;
+  out << run.compareLog[m];
+  for (int i = 0; i < numSolvers; i++) {
+    out << run.log[m * numSolvers + i];
+    delete vecSiP[i];
+    vecSiP[i] = NULL;
+  }
+
+  std::lock_guard< std::mutex > lock(run.mutex);
+  std::cout << out.str();
+  std::cout.flush();
+}
+
+void runNetlibWorker(NetlibParallelRun *run)
+{
+  // outcomes of this thread
+  OsiUnitTest::TestOutcomes outcomes;
+  OsiUnitTest::setThreadOutcomes(&outcomes);
+  std::unique_lock< std::mutex > lock(run->mutex);
+  for (;;) {
+    while (run->queue.empty() && run->numRunning > 0)
+      run->wakeUp.wait(lock);
+    if (run->queue.empty())
+      break;
+    const int task = run->queue.front();
+    run->queue.pop_front();
+    run->numRunning++;
+    lock.unlock();
+
+    const bool read = (task < run->numTasks);
+    const int k = read ? task : task - run->numTasks;
+    const int m = k / run->numSolvers;
+    if (read)
+      readNetlibTask(*run, k);
+    else
+      solveNetlibTask(*run, k);
+    lock.lock();
+    bool lastTask = (--run->numPending[m] == 0);
+    lock.unlock();
+    if (lastTask && read) {
+      // all solvers have read problem m; compare and queue the solves
+      const int numRead = compareNetlibProblem(*run, m);
+      lock.lock();
+      run->numPending[m] = numRead;
+      for (int i = run->numSolvers - 1; i >= 0; i--) {
+        const int j = m * run->numSolvers + i;
+        if (run->siStage[j] >= 1)
+          run->queue.push_front(run->numTasks + j);
+      }
+      lock.unlock();
+      lastTask = (numRead == 0);
+    }
+    if (lastTask)
+      finishNetlibProblem(*run, m);
+
+    lock.lock();
+    run->numRunning--;
+    run->wakeUp.notify_all();
+  }
+  // hand over the outcomes of this thread
+  OsiUnitTest::setThreadOutcomes(NULL);
+  run->outcomes->add(outcomes);
+}
+
+} // namespace
+#endif
+
+/*! \brief Run solvers on NetLib problems in parallel.
+
+  See the sequential version above for the tests made. Each (solver, problem)
+  pair is read and solved on its own clone by numberThreads workers, with
+  the representations compared in between and test outcomes collected per
+  thread and merged at the end. A table of the wall
+  clock time of each solve is printed last.
+*/
+
+void OsiSolverInterfaceMpsUnitTest(const std::vector< OsiSolverInterface * > &vecEmptySiP,
+  const std::string &mpsDir, int numberThreads)
+
+{
+#if OSI_HAS_THREADS
+  if (numberThreads <= 1) {
+    OsiSolverInterfaceMpsUnitTest(vecEmptySiP, mpsDir);
+    return;
+  }
+  NetlibParallelRun run;
+  getNetlibProblems(run.mpsName, run.minObj, run.nRows, run.nCols,
+    run.objValue, run.objValueTol);
+  const int numProblems = static_cast< int >(run.mpsName.size());
+  const int numSolvers = static_cast< int >(vecEmptySiP.size());
+  run.vecEmptySiP = &vecEmptySiP;
+  run.mpsDir = mpsDir;
+  run.numSolvers = numSolvers;
+  run.numTasks = numProblems * numSolvers;
+  for (int k = 0; k < run.numTasks; k++)
+    run.queue.push_back(k);
+  run.numRunning = 0;
+  run.siP.assign(run.numTasks, NULL);
+  run.siStage.assign(run.numTasks, 0);
+  run.timeTaken.assign(run.numTasks, -1.0);
+  run.log.resize(run.numTasks);
+  run.numPending.assign(numProblems, numSolvers);
+  run.compareLog.resize(numProblems);
+  run.outcomes = &OsiUnitTest::outcomes;
+
+  double startTime = CoinWallclockTime();
+  std::vector< std::thread > workers;
+  for (int t = 0; t < numberThreads; t++)
+    workers.push_back(std::thread(runNetlibWorker, &run));
+  for (int t = 0; t < numberThreads; t++)
+    workers[t].join();
+  double wallTime = CoinWallclockTime() - startTime;
+
+  /*
+  Print the timing table (seconds for each solve, - if no optimal solution)
+  and a summary for each solver.
+*/
+  std::vector< std::string > siName(numSolvers);
+  std::vector< int > numProbSolved(numSolvers, 0);
+  std::vector< double > timeTaken(numSolvers, 0.0);
+  std::cout << std::endl
+            << std::setw(10) << "problem";
+  for (int i = 0; i < numSolvers; i++) {
+    vecEmptySiP[i]->getStrParam(OsiSolverName, siName[i]);
+    std::cout << " " << std::setw(10) << siName[i];
+  }
+  std::cout << std::endl;
+  std::cout << std::fixed << std::setprecision(3);
+  for (int m = 0; m < numProblems; m++) {
+    std::cout << std::setw(10) << run.mpsName[m];
+    for (int i = 0; i < numSolvers; i++) {
+      const int k = m * numSolvers + i;
+      if (run.timeTaken[k] >= 0.0) {
+        std::cout << " " << std::setw(10) << run.timeTaken[k];
+        timeTaken[i] += run.timeTaken[k];
+      } else {
+        std::cout << " " << std::setw(10) << "-";
+      }
+      if (run.siStage[k] == 2)
+        numProbSolved[i]++;
+    }
+    std::cout << std::endl;
+  }
+  std::cout << std::setw(10) << "total";
+  for (int i = 0; i < numSolvers; i++)
+    std::cout << " " << std::setw(10) << timeTaken[i];
+  std::cout << std::endl;
+  std::cout.unsetf(std::ios::floatfield);
+  std::cout << std::setprecision(6);
+
+  for (int i = 0; i < numSolvers; i++) {
+    std::cout
+      << siName[i] << " solved "
+      << numProbSolved[i] << " out of "
+      << numProblems << " and took " << timeTaken[i] << " seconds."
+      << std::endl;
+  }
+  std::cout << "Netlib problems took " << wallTime << " seconds with "
+            << numberThreads << " threads." << std::endl;
+#else
+  OsiSolverInterfaceMpsUnitTest(vecEmptySiP, mpsDir);
+#endif
+}
+
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -4,6 +4,8 @@
 
 #include "CoinPragma.hpp"
 
+#include <cstdio>
+
 #include "OsiUnitTests.hpp"
 
 #include "OsiRowCutDebugger.hpp"
@@ -105,6 +107,48 @@ void OsiRowCutDebuggerUnitTest(const OsiSolverInterface *baseSiP, const std::str
     OSIUNITTEST_ASSERT_ERROR(debugger->invalidCut(cut[1]), {}, "osirowcutdebugger", "recognize (in)valid cut");
     OSIUNITTEST_ASSERT_ERROR(debugger->validateCuts(cs, 0, 2) == 1, {}, "osirowcutdebugger", "recognize (in)valid cut");
     OSIUNITTEST_ASSERT_ERROR(debugger->validateCuts(cs, 0, 1) == 0, {}, "osirowcutdebugger", "recognize (in)valid cut");
+
+    /*
+      Round trip the known solution through solution files in both formats.
+      Only the integer values are written, so activation has to recompute
+      the continuous values.
+    */
+    for (int binary = 0; binary < 2; binary++) {
+      const char *solnFile = binary ? "osirowcutdebugger.bin" : "osirowcutdebugger.txt";
+      remove(solnFile);
+      OSIUNITTEST_ASSERT_ERROR(debugger->writeSolutionFile(*imP, solnFile, "exmip1", binary != 0), {}, "osirowcutdebugger", "write solution file");
+
+      OsiRowCutDebugger fromFile;
+      OSIUNITTEST_ASSERT_ERROR(fromFile.activateFromFile(*imP, solnFile, "/x/EXMIP1.mps"), {}, "osirowcutdebugger", "activate from solution file");
+      OSIUNITTEST_ASSERT_ERROR(fromFile.numberColumns_ == 8, {}, "osirowcutdebugger", "activate from solution file");
+      OSIUNITTEST_ASSERT_ERROR(fromFile.active() && eq(objValue, objCoefs.dotProduct(fromFile.knownSolution_)), {}, "osirowcutdebugger", "activate from solution file");
+      OSIUNITTEST_ASSERT_ERROR(fromFile.activateFromFile(*imP, solnFile), {}, "osirowcutdebugger", "activate from solution file by structure");
+      OSIUNITTEST_ASSERT_ERROR(!fromFile.activateFromFile(*imP, solnFile, "p0033"), {}, "osirowcutdebugger", "reject unknown model in solution file");
+      OSIUNITTEST_ASSERT_ERROR(!fromFile.active(), {}, "osirowcutdebugger", "reject unknown model in solution file");
+      remove(solnFile);
+    }
+
+    /*
+      A corrupt binary file with a huge name length must be rejected, not
+      make the reader allocate the name.
+    */
+    {
+      const char *solnFile = "osirowcutdebugger.bin";
+      FILE *fp = fopen(solnFile, "wb");
+      OSIUNITTEST_ASSERT_ERROR(fp != NULL, {}, "osirowcutdebugger", "write corrupt solution file");
+      if (fp) {
+        const char magic[8] = { 'O', 's', 'i', 'K', 'S', 'o', 'l', '1' };
+        const int nameLength = 0x7fffffff;
+        fwrite(magic, 1, 8, fp);
+        fwrite(&nameLength, sizeof(int), 1, fp);
+        fwrite("exmip1", 1, 6, fp);
+        fclose(fp);
+        OsiRowCutDebugger fromFile;
+        OSIUNITTEST_ASSERT_ERROR(!fromFile.activateFromFile(*imP, solnFile), {}, "osirowcutdebugger", "reject corrupt solution file");
+        OSIUNITTEST_ASSERT_ERROR(!fromFile.active(), {}, "osirowcutdebugger", "reject corrupt solution file");
+        remove(solnFile);
+      }
+    }
     delete imP;
   }
 }
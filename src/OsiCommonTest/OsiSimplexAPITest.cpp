@@ -354,6 +354,17 @@ void testBInvARow(const OsiSolverInterface *si)
   need to report.
 */
   OSIUNITTEST_ASSERT_ERROR(abariMtx.isEquivalent2(abarjMtx), {}, solverName, "testBInvARow: tableaus built by rows and columns match");
+  /*
+  The batched version should give the same tableau in one call.
+*/
+  int *rows = new int[m];
+  for (int i = 0; i < m; i++)
+    rows[i] = i;
+  CoinPackedMatrix abarMtx;
+  OSIUNITTEST_CATCH_ERROR(si->getBInvARows(m, rows, abarMtx), {}, solverName, "testBInvARow: getBInvARows");
+  delete[] rows;
+  abarMtx.setDimensions(m, n);
+  OSIUNITTEST_ASSERT_ERROR(abarMtx.isEquivalent2(abariMtx), {}, solverName, "testBInvARow: getBInvARows matches getBInvARow");
 }
 
 /*
@@ -58,7 +58,12 @@ If you work on this code, please keep these conventions in mind:
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <fstream>
+#include <map>
 #include <cstdio>
+#if OSI_HAS_THREADS
+#include <thread>
+#endif
 
 /*
   A utility definition which allows for easy suppression of unused variable
@@ -83,6 +88,8 @@ If you work on this code, please keep these conventions in mind:
 #include "OsiRowCut.hpp"
 #include "OsiCuts.hpp"
 #include "OsiPresolve.hpp"
+#include "OsiTrace.hpp"
+#include "OsiStatistics.hpp"
 
 /*
   Define helper routines in the file-local namespace.
@@ -90,6 +97,7 @@ If you work on this code, please keep these conventions in mind:
 
 namespace OsiUnitTest {
 extern void testSimplexAPI(const OsiSolverInterface *emptySi, const std::string &mpsDir);
+extern void testBranching(const OsiSolverInterface *emptySi, const std::string &mpsDir);
 }
 
 using namespace OsiUnitTest;
@@ -1806,6 +1814,19 @@ void testNames(const OsiSolverInterface *emptySi, std::string fn)
     }
   }
   OSIUNITTEST_ASSERT_WARNING(ok == true, {}, solverName, "testNames full names: column names");
+  /*
+  Names are shared with a clone until one side changes them. Renaming a row
+  in the clone must leave the original alone.
+*/
+  {
+    OsiSolverInterface *si2 = si->clone();
+    std::string oldName = si->getRowName(0);
+    si2->setRowName(0, "CLONEROW");
+    OSIUNITTEST_ASSERT_WARNING(si2->getRowName(0) == "CLONEROW", {}, solverName, "testNames clone: renamed row in clone");
+    OSIUNITTEST_ASSERT_WARNING(si->getRowName(0) == oldName, {}, solverName, "testNames clone: original row name kept");
+    delete si2;
+    OSIUNITTEST_ASSERT_WARNING(si->getRowNames()[0] == oldName, {}, solverName, "testNames clone: names after deleting clone");
+  }
 
   delete si;
 }
@@ -1964,6 +1985,242 @@ void testSettingSolutions(OsiSolverInterface &proto)
 
 //--------------------------------------------------------------------------
 
+/*! \brief Tests for OsiModelView.
+
+  The view should point at the solver's own arrays, and should go stale
+  when the model generation changes.
+*/
+void testModelView(const OsiSolverInterface *proto)
+
+{
+  OsiSolverInterface *si = proto->clone();
+  OsiModelView view(si);
+
+  OSIUNITTEST_ASSERT_ERROR(view.numberRows_ == si->getNumRows(), {}, *si, "model view: number of rows");
+  OSIUNITTEST_ASSERT_ERROR(view.numberColumns_ == si->getNumCols(), {}, *si, "model view: number of columns");
+  OSIUNITTEST_ASSERT_ERROR(view.colLower_ == si->getColLower(), {}, *si, "model view: column lower bounds");
+  OSIUNITTEST_ASSERT_ERROR(view.matrixByRow_ == si->getMatrixByRow(), {}, *si, "model view: row ordered matrix");
+  OSIUNITTEST_ASSERT_ERROR(!view.stale(), {}, *si, "model view: fresh view not stale");
+  si->markModelChanged();
+  OSIUNITTEST_ASSERT_ERROR(view.stale(), {}, *si, "model view: stale after model change");
+  view.refresh(si);
+  OSIUNITTEST_ASSERT_ERROR(!view.stale(), {}, *si, "model view: not stale after refresh");
+
+  delete si;
+}
+
+//--------------------------------------------------------------------------
+
+/*! \brief Tests for OsiTrace.
+
+  Records nested calls, in the calling thread and, if Osi has threads, in
+  two rounds of workers. Writes them as a Chrome trace and reads it back.
+  Every begin must be closed by an end of the same name on the same
+  thread, and the workers of the second round must reuse the buffers of
+  the first.
+*/
+void traceSomeCalls(int numberCalls)
+{
+  for (int i = 0; i < numberCalls; i++) {
+    OsiTraceScope outer("testOuter");
+    OsiTraceScope inner("testInner");
+  }
+}
+
+void testTrace(const OsiSolverInterface *proto)
+
+{
+  std::string solverName = "Unknown solver";
+  proto->getStrParam(OsiSolverName, solverName);
+  const int numberCalls = 10;
+  int numberThreads = 1;
+
+  OsiTrace::start();
+  traceSomeCalls(numberCalls);
+#if OSI_HAS_THREADS
+  const int numberWorkers = 2;
+  for (int round = 0; round < 2; round++) {
+    std::vector< std::thread > workers;
+    for (int i = 0; i < numberWorkers; i++)
+      workers.push_back(std::thread(traceSomeCalls, numberCalls));
+    for (int i = 0; i < numberWorkers; i++)
+      workers[i].join();
+  }
+  numberThreads += 2 * numberWorkers;
+#endif
+  OsiTrace::stop();
+  const char *fileName = "osiTrace.json";
+  OSIUNITTEST_ASSERT_ERROR(OsiTrace::writeChromeTrace(fileName) == 0, return, solverName, "trace: write Chrome trace");
+
+  // names of the calls still open, by thread id
+  std::map< int, std::vector< std::string > > open;
+  int numberPairs = 0;
+  bool nested = true;
+  std::ifstream in(fileName);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::string::size_type name = line.find("\"name\":\"");
+    std::string::size_type phase = line.find("\"ph\":\"");
+    std::string::size_type tid = line.find("\"tid\":");
+    if (name == std::string::npos || phase == std::string::npos || tid == std::string::npos)
+      continue;
+    name += 8;
+    std::string callName = line.substr(name, line.find('"', name) - name);
+    if (callName.compare(0, 4, "test"))
+      continue;
+    std::vector< std::string > &stack = open[atoi(line.c_str() + tid + 6)];
+    if (line[phase + 6] == 'B') {
+      stack.push_back(callName);
+    } else if (stack.empty() || stack.back() != callName) {
+      nested = false;
+    } else {
+      stack.pop_back();
+      numberPairs++;
+    }
+  }
+  in.close();
+  remove(fileName);
+
+  bool allClosed = true;
+  for (std::map< int, std::vector< std::string > >::const_iterator it = open.begin(); it != open.end(); ++it) {
+    if (!it->second.empty())
+      allClosed = false;
+  }
+  OSIUNITTEST_ASSERT_ERROR(nested, {}, solverName, "trace: ends match begins");
+  OSIUNITTEST_ASSERT_ERROR(allClosed, {}, solverName, "trace: every begin has an end");
+  OSIUNITTEST_ASSERT_ERROR(numberPairs == 2 * numberCalls * numberThreads, {}, solverName, "trace: number of calls");
+#if OSI_HAS_THREADS
+  OSIUNITTEST_ASSERT_ERROR(static_cast< int >(open.size()) <= 1 + numberWorkers, {}, solverName, "trace: buffers of finished threads reused");
+#endif
+}
+
+//--------------------------------------------------------------------------
+
+/*
+  Message handler which just counts the lines printed.
+*/
+class OsiCountingHandler : public CoinMessageHandler {
+public:
+  OsiCountingHandler()
+    : numberLines_(0)
+  {
+  }
+  virtual int print()
+  {
+    numberLines_++;
+    return 0;
+  }
+  int numberLines() const
+  {
+    return numberLines_;
+  }
+
+private:
+  int numberLines_;
+};
+
+/*! \brief Tests for OsiStatistics.
+
+  Checks the counting, nesting and printing of OsiStatistics itself, which
+  is there in any build. If Osi records statistics (OSI_HAS_STATISTICS),
+  also checks that setStatistics(true) records the calls and LP iterations
+  of initialSolve, resolve and addRows, that a nested call of an entry
+  point is counted once, and that printStatistics prints a line for each
+  entry called. Otherwise setStatistics must leave statistics() NULL.
+*/
+void testStatistics(const OsiSolverInterface *proto)
+
+{
+  std::string solverName = "Unknown solver";
+  proto->getStrParam(OsiSolverName, solverName);
+  OsiSolverInterface *si = proto->clone();
+
+  {
+    OsiStatistics stats;
+    OSIUNITTEST_ASSERT_ERROR(stats.enter(OsiStatistics::AddRows), {}, solverName, "statistics: first enter");
+    OSIUNITTEST_ASSERT_ERROR(!stats.enter(OsiStatistics::AddRows), {}, solverName, "statistics: nested enter");
+    stats.leave(OsiStatistics::AddRows);
+    stats.leave(OsiStatistics::AddRows);
+    OSIUNITTEST_ASSERT_ERROR(stats.enter(OsiStatistics::AddRows), {}, solverName, "statistics: enter after leaving");
+    stats.leave(OsiStatistics::AddRows);
+    stats.record(OsiStatistics::Resolve, 2.0, 5);
+    stats.record(OsiStatistics::Resolve, 1.0, 3);
+    OSIUNITTEST_ASSERT_ERROR(stats.numberCalls(OsiStatistics::Resolve) == 2, {}, solverName, "statistics: calls recorded");
+    OSIUNITTEST_ASSERT_ERROR(stats.numberCalls(OsiStatistics::AddRows) == 0, {}, solverName, "statistics: enter does not record");
+    OSIUNITTEST_ASSERT_ERROR(stats.totalTime(OsiStatistics::Resolve) == 3.0, {}, solverName, "statistics: total time");
+    OSIUNITTEST_ASSERT_ERROR(stats.maximumTime(OsiStatistics::Resolve) == 2.0, {}, solverName, "statistics: maximum time");
+    OSIUNITTEST_ASSERT_ERROR(stats.numberIterations(OsiStatistics::Resolve) == 8.0, {}, solverName, "statistics: iterations");
+    OSIUNITTEST_ASSERT_ERROR(std::string(OsiStatistics::entryName(OsiStatistics::Resolve)) == "resolve", {}, solverName, "statistics: entry name");
+
+    OsiCountingHandler handler;
+    handler.setLogLevel(1);
+    stats.print(&handler, si->messages());
+    OSIUNITTEST_ASSERT_ERROR(handler.numberLines() == 2, {}, solverName, "statistics: print heading and called entries");
+    stats.clear();
+    OSIUNITTEST_ASSERT_ERROR(stats.numberCalls(OsiStatistics::Resolve) == 0 && stats.totalTime(OsiStatistics::Resolve) == 0.0, {}, solverName, "statistics: clear");
+  }
+
+  OsiCountingHandler handler;
+  handler.setLogLevel(1);
+  si->passInMessageHandler(&handler);
+  OSIUNITTEST_ASSERT_ERROR(si->statistics() == NULL, {}, solverName, "statistics: off by default");
+  si->setStatistics(true);
+#if OSI_HAS_STATISTICS
+  OsiStatistics *stats = si->statistics();
+  OSIUNITTEST_ASSERT_ERROR(stats != NULL, { delete si; return; }, solverName, "statistics: on");
+
+  si->initialSolve();
+  OSIUNITTEST_ASSERT_ERROR(stats->numberCalls(OsiStatistics::InitialSolve) == 1, {}, solverName, "statistics: initialSolve counted");
+  OSIUNITTEST_ASSERT_ERROR(stats->numberIterations(OsiStatistics::InitialSolve) == si->getIterationCount(), {}, solverName, "statistics: initialSolve iterations");
+  OSIUNITTEST_ASSERT_ERROR(stats->totalTime(OsiStatistics::InitialSolve) >= 0.0 && stats->maximumTime(OsiStatistics::InitialSolve) <= stats->totalTime(OsiStatistics::InitialSolve), {}, solverName, "statistics: initialSolve time");
+  si->resolve();
+  OSIUNITTEST_ASSERT_ERROR(stats->numberCalls(OsiStatistics::Resolve) == 1, {}, solverName, "statistics: resolve counted");
+  OSIUNITTEST_ASSERT_ERROR(stats->numberIterations(OsiStatistics::Resolve) == si->getIterationCount(), {}, solverName, "statistics: resolve iterations");
+
+  // two rows in one call; backends doing it row by row still count one
+  const int numberColumns = si->getNumCols();
+  CoinPackedVector row;
+  for (int j = 0; j < numberColumns; j++)
+    row.insert(j, 1.0);
+  const CoinPackedVectorBase *rows[2] = { &row, &row };
+  const double rowLower[2] = { -si->getInfinity(), -si->getInfinity() };
+  const double rowUpper[2] = { 1.0e6, 1.0e6 };
+  si->addRows(2, rows, rowLower, rowUpper);
+  OSIUNITTEST_ASSERT_ERROR(stats->numberCalls(OsiStatistics::AddRows) == 1, {}, solverName, "statistics: nested addRows counted once");
+
+  // explicitly nested timers
+  {
+    OsiStatisticsTimer outer(si, OsiStatistics::ApplyCuts);
+    {
+      OsiStatisticsTimer inner(si, OsiStatistics::ApplyCuts);
+    }
+    OSIUNITTEST_ASSERT_ERROR(stats->numberCalls(OsiStatistics::ApplyCuts) == 0, {}, solverName, "statistics: inner timer not counted");
+  }
+  OSIUNITTEST_ASSERT_ERROR(stats->numberCalls(OsiStatistics::ApplyCuts) == 1, {}, solverName, "statistics: outer timer counted");
+
+  int numberCalled = 0;
+  for (int i = 0; i < OsiStatistics::NumberEntries; i++) {
+    if (stats->numberCalls(static_cast< OsiStatistics::Entry >(i)))
+      numberCalled++;
+  }
+  si->printStatistics();
+  OSIUNITTEST_ASSERT_ERROR(handler.numberLines() == 1 + numberCalled, {}, solverName, "statistics: printStatistics");
+
+  si->setStatistics(true);
+  OSIUNITTEST_ASSERT_ERROR(si->statistics() == stats && !stats->numberCalls(OsiStatistics::InitialSolve), {}, solverName, "statistics: restart clears");
+  si->setStatistics(false);
+  OSIUNITTEST_ASSERT_ERROR(si->statistics() == NULL, {}, solverName, "statistics: off");
+#else
+  OSIUNITTEST_ASSERT_ERROR(si->statistics() == NULL, {}, solverName, "statistics: not recorded without OSI_HAS_STATISTICS");
+  si->printStatistics();
+  OSIUNITTEST_ASSERT_ERROR(handler.numberLines() == 0, {}, solverName, "statistics: nothing to print");
+  si->setStatistics(false);
+#endif
+  delete si;
+}
+
+//--------------------------------------------------------------------------
+
 /*! \brief Helper routines to test OSI parameters.
 
   A set of helper routines to test integer, double, and hint parameter
@@ -2272,6 +2529,7 @@ void testArtifStatus(const OsiSolverInterface *emptySi)
   show the correct status.
 */
   CoinRelFltEq eq;
+  CoinWarmStart *reference = NULL;
 
   for (int iter = 0; iter <= 1; iter++) {
     si->setObjSense(objSense[iter]);
@@ -2295,8 +2553,30 @@ void testArtifStatus(const OsiSolverInterface *emptySi)
     }
     OSIUNITTEST_ASSERT_ERROR(ok == true, {}, *si, "testArtifStatus: artificial variable status");
 
+    /*
+    Store the second basis as a diff against the first and check it comes
+    back intact.
+  */
+    if (!reference) {
+      reference = ws;
+      continue;
+    }
+    CoinWarmStartDiff *diff = si->getWarmStartDiff(reference);
+    OSIUNITTEST_ASSERT_ERROR(diff != NULL, {}, *si, "testArtifStatus: warm start diff");
+    if (diff) {
+      OSIUNITTEST_ASSERT_ERROR(si->setWarmStartDiff(reference, diff), {}, *si, "testArtifStatus: set warm start from diff");
+      CoinWarmStartBasis *wsb2 = dynamic_cast< CoinWarmStartBasis * >(si->getWarmStart());
+      ok = wsb2 != NULL;
+      for (int i = 0; ok && i < rowCnt; i++)
+        ok = wsb2->getArtifStatus(i) == wsb->getArtifStatus(i);
+      OSIUNITTEST_ASSERT_ERROR(ok == true, {}, *si, "testArtifStatus: basis from warm start diff");
+      delete wsb2;
+      delete diff;
+    }
+
     delete ws;
   }
+  delete reference;
   /*
   Clean up.
 */
@@ -4271,6 +4551,36 @@ void OsiSolverInterfaceCommonUnitTest(const OsiSolverInterface *emptySi,
 
     delete &im;
   }
+  /*
+    applyRowCuts, the second time with more cuts: the new rows and their
+    bounds must be those of the cuts, in order.
+  */
+  {
+    OsiSolverInterface *si = exmip1Si->clone();
+    const int numberRows = si->getNumRows();
+    OsiRowCut cuts[3];
+    for (int k = 0; k < 3; k++) {
+      int index[2] = { k, k + 1 };
+      double element[2] = { 1.0, k + 2.0 };
+      cuts[k].setRow(2, index, element);
+      cuts[k].setLb(-1.0 - k);
+      cuts[k].setUb(10.0 + k);
+    }
+    si->applyRowCuts(1, cuts);
+    const OsiRowCut *reversed[3] = { &cuts[2], &cuts[1], &cuts[0] };
+    si->applyRowCuts(3, reversed);
+    bool same = (si->getNumRows() == numberRows + 4);
+    const OsiRowCut *added[4] = { &cuts[0], &cuts[2], &cuts[1], &cuts[0] };
+    for (int i = 0; i < 4 && same; i++) {
+      const int iRow = numberRows + i;
+      const CoinShallowPackedVector row = si->getMatrixByRow()->getVector(iRow);
+      same = row.isEquivalent(added[i]->row())
+        && si->getRowLower()[iRow] == added[i]->lb()
+        && si->getRowUpper()[iRow] == added[i]->ub();
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, solverName, "apply row cuts: rows and bounds of the cuts added in order");
+    delete si;
+  }
   // end of apply cut method testing
 
   /*
@@ -4290,6 +4600,15 @@ void OsiSolverInterfaceCommonUnitTest(const OsiSolverInterface *emptySi,
 */
   testSettingSolutions(*exmip1Si);
 
+  // Test read only model view
+  testModelView(exmip1Si);
+
+  // Test trace events
+  testTrace(exmip1Si);
+
+  // Test call statistics
+  testStatistics(exmip1Si);
+
   // Test column type methods
   // skip for vol since it does not support this function
 
@@ -4369,6 +4688,16 @@ void OsiSolverInterfaceCommonUnitTest(const OsiSolverInterface *emptySi,
     OSIUNITTEST_ASSERT_ERROR(fim.isIntegerNonBinary(3), {}, solverName, "column type methods: convert binary to integer variable");
     OSIUNITTEST_ASSERT_ERROR(!fim.isIntegerNonBinary(4), {}, solverName, "column type methods: convert binary to integer variable");
 
+    // bit-packed types must agree
+    const unsigned int *integerMask = fim.getColTypeMask();
+    const unsigned int *binaryMask = fim.getColTypeMask(true);
+    OSIUNITTEST_ASSERT_ERROR((integerMask[0] & 0x1f) == 0xc, {}, solverName, "column type methods: getColTypeMask");
+    OSIUNITTEST_ASSERT_ERROR((binaryMask[0] & 0x1f) == 0, {}, solverName, "column type methods: getColTypeMask");
+    fim.setColUpper(3, 1.0);
+    OSIUNITTEST_ASSERT_ERROR(fim.isBinary(3), {}, solverName, "column type methods: convert integer to binary variable");
+    OSIUNITTEST_ASSERT_ERROR(fim.getColType(true)[3] == 1, {}, solverName, "column type methods: convert integer to binary variable");
+    OSIUNITTEST_ASSERT_ERROR((fim.getColTypeMask(true)[0] & 0x1f) == 0x8, {}, solverName, "column type methods: getColTypeMask");
+
     delete &fim;
   }
 
@@ -4640,6 +4969,14 @@ void OsiSolverInterfaceCommonUnitTest(const OsiSolverInterface *emptySi,
     OSIUNITTEST_ADD_OUTCOME(solverName, "testReducedCosts", "skipped test", OsiUnitTest::TestOutcome::NOTE, true);
     OSIUNITTEST_ADD_OUTCOME(solverName, "testDualRays", "skipped test", OsiUnitTest::TestOutcome::NOTE, true);
   }
+  /*
+  Test choosing branching variables and the reference branch and bound on a
+  small MIP. Vol's approximate solutions are no good for a search.
+*/
+  if (!volSolverInterface && !symSolverInterface)
+    testBranching(emptySi, mpsDir);
+  else
+    OSIUNITTEST_ADD_OUTCOME(solverName, "testBranching", "skipped test", OsiUnitTest::TestOutcome::NOTE, true);
 }
 
 /*
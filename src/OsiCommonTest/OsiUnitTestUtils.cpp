@@ -42,6 +42,30 @@ unsigned int haltonerror = 0;
 
 TestOutcomes outcomes;
 
+#if OSI_HAS_THREADS
+// list of the calling thread if it has one (see setThreadOutcomes)
+static thread_local TestOutcomes *currentOutcomes = NULL;
+
+TestOutcomes &threadOutcomes()
+{
+  return currentOutcomes ? *currentOutcomes : outcomes;
+}
+
+void setThreadOutcomes(TestOutcomes *threadOutcomes)
+{
+  currentOutcomes = threadOutcomes;
+}
+#else
+TestOutcomes &threadOutcomes()
+{
+  return outcomes;
+}
+
+void setThreadOutcomes(TestOutcomes *)
+{
+}
+#endif
+
 //#############################################################################
 // Helper routines for messages.
 //#############################################################################
@@ -359,6 +383,7 @@ bool processParameters(int argc, const char **argv, std::map< std::string, std::
   definedKeyWords.insert("-cutsOnly");
   definedKeyWords.insert("-verbosity");
   definedKeyWords.insert("-onerror");
+  definedKeyWords.insert("-threads");
 
   /*
       Set default values for data directories.
@@ -412,7 +437,7 @@ bool processParameters(int argc, const char **argv, std::map< std::string, std::
     if (definedKeyWords.find(key) == definedKeyWords.end()) {
       if (key != "-usage" && key != "-help")
         std::cerr << "Undefined parameter \"" << key << "\"." << std::endl;
-      std::cerr << "Usage: unitTest [-nobuf] [-mpsDir=V1] [-netlibDir=V2] [-miplibDir=V3] [-testOsiSolverInterface] [-cutsOnly] [-verbosity=num]" << std::endl;
+      std::cerr << "Usage: unitTest [-nobuf] [-mpsDir=V1] [-netlibDir=V2] [-miplibDir=V3] [-testOsiSolverInterface] [-cutsOnly] [-verbosity=num] [-threads=num]" << std::endl;
       std::cerr << "  where:" << std::endl;
       std::cerr << "  -cerr2cout: redirect cerr to cout; sometimes useful to synchronise cout & cerr." << std::endl;
       std::cerr << "  -mpsDir: directory containing mps test files." << std::endl
@@ -430,6 +455,8 @@ bool processParameters(int argc, const char **argv, std::map< std::string, std::
                 << "       Default is 0 (minimal output)." << std::endl;
       std::cerr << "  -onerror: behaviour in case of failing test (continue, wait, stop)." << std::endl
                 << "       Default is continue." << std::endl;
+      std::cerr << "  -threads: number of threads for the netlib problem set." << std::endl
+                << "       Default is 1 (more need a build with OSI_HAS_THREADS)." << std::endl;
       return false;
     }
 
@@ -42,6 +42,26 @@ void OsiSolverInterfaceMpsUnitTest
   (const std::vector<OsiSolverInterface*> & vecEmptySiP,
    const std::string& mpsDir);
 
+/** Parallel version of OsiSolverInterfaceMpsUnitTest.
+ *
+ * Each (solver, problem) pair is a task, run on a fresh clone of the solver
+ * by one of \p numberThreads workers. The output for a problem is printed
+ * in one piece once all solvers are done with it. The pairwise comparison
+ * of adjacent solvers is made as in the sequential test, once all solvers
+ * have read the problem and before any of them solves it.
+ * Each worker collects test outcomes in a list of its own (see
+ * OsiUnitTest::setThreadOutcomes), which is added to OsiUnitTest::outcomes
+ * at the end. A table with the time taken by each task is printed last.
+ *
+ * The solvers must be safe to run in separate instances concurrently.
+ * Without OSI_HAS_THREADS (see OsiConfig.h), or for one thread, this just
+ * runs the sequential test.
+ */
+OSICOMMONTESTLIB_EXPORT
+void OsiSolverInterfaceMpsUnitTest
+  (const std::vector<OsiSolverInterface*> & vecEmptySiP,
+   const std::string& mpsDir, int numberThreads);
+
 /** A function that tests the methods in the OsiSolverInterface class.
  * Some time ago, if this method is compiled with optimization,
  * the compilation took 10-15 minutes and the machine pages (has 256M core memory!)...
@@ -100,6 +120,24 @@ extern OSICOMMONTESTLIB_EXPORT unsigned int haltonerror;
  */
 extern OSICOMMONTESTLIB_EXPORT TestOutcomes outcomes;
 
+/*! \brief Test outcomes of the calling thread
+
+  The list the test macros record into: OsiUnitTest::outcomes, unless the
+  calling thread has set a list of its own with setThreadOutcomes.
+ */
+OSICOMMONTESTLIB_EXPORT
+TestOutcomes &threadOutcomes();
+
+/*! \brief Set the test outcomes of the calling thread
+
+  A worker thread of a parallel test records into \p threadOutcomes
+  (NULL to go back to OsiUnitTest::outcomes) and adds it to
+  OsiUnitTest::outcomes when done. Without OSI_HAS_THREADS there is just
+  one list and this does nothing.
+ */
+OSICOMMONTESTLIB_EXPORT
+void setThreadOutcomes(TestOutcomes *threadOutcomes);
+
 /*! \brief Print an error message
 
   Formatted as "XxxSolverInterface testing issue: message" where Xxx is the string
@@ -233,6 +271,9 @@ class OSICOMMONTESTLIB_EXPORT TestOutcomes {
     	     TestOutcome::SeverityLevel sev, const char* file, int line,
 	     bool exp = false)
     { outcomes.push_back(TestOutcome(comp,tst,cond,sev,file,line,exp)); }
+    /// Add the outcomes of another list (say collected by another thread)
+    void add(const TestOutcomes &other)
+    { outcomes.insert(outcomes.end(),other.outcomes.begin(),other.outcomes.end()); }
 
   /*! \brief Add an outcome to the list
 
@@ -264,7 +305,7 @@ bool OsiUnitTestAssertSeverityExpected(
   TestOutcome::SeverityLevel severity, bool expected)
 {
   if (condition) {
-    OsiUnitTest::outcomes.add(component, testname, condition_str,
+    OsiUnitTest::threadOutcomes().add(component, testname, condition_str,
       OsiUnitTest::TestOutcome::PASSED, filename, line, false);
     if (OsiUnitTest::verbosity >= 2) {
       std::ostringstream successmsg;
@@ -274,7 +315,7 @@ bool OsiUnitTestAssertSeverityExpected(
     }
     return true;
   }
-  OsiUnitTest::outcomes.add(component, testname, condition_str,
+  OsiUnitTest::threadOutcomes().add(component, testname, condition_str,
     severity, filename, line, expected);
   OsiUnitTest::failureMessage(component, testname, condition_str);
   switch (OsiUnitTest::haltonerror) {
@@ -294,9 +335,9 @@ bool OsiUnitTestAssertSeverityExpected(
   return false;
 }
 
-/// Add a test outcome to the list held in OsiUnitTest::outcomes
+/// Add a test outcome to the list of the calling thread (see OsiUnitTest::threadOutcomes)
 #define OSIUNITTEST_ADD_OUTCOME(component, testname, testcondition, severity, expected) \
-  OsiUnitTest::outcomes.add(component, testname, testcondition, severity,               \
+  OsiUnitTest::threadOutcomes().add(component, testname, testcondition, severity,       \
     __FILE__, __LINE__, expected)
 /*! \brief Test for a condition and record the result
 
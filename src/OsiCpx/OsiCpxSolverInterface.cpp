@@ -233,6 +233,8 @@ void OsiCpxSolverInterface::freeColType()
 
 void OsiCpxSolverInterface::initialSolve()
 {
+  OSI_STATISTICS_SCOPE(this, InitialSolve);
+  OSI_TRACE_SCOPE("initialSolve");
   debugMessage("OsiCpxSolverInterface::initialSolve()\n");
 
   switchToLP();
@@ -360,6 +362,8 @@ void OsiCpxSolverInterface::initialSolve()
 //-----------------------------------------------------------------------------
 void OsiCpxSolverInterface::resolve()
 {
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
   debugMessage("OsiCpxSolverInterface::resolve()\n");
 
   switchToLP();
@@ -803,6 +807,8 @@ CoinWarmStart *OsiCpxSolverInterface::getEmptyWarmStart() const
 
 CoinWarmStart *OsiCpxSolverInterface::getWarmStart() const
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
   debugMessage("OsiCpxSolverInterface::getWarmStart()\n");
 
   if (probtypemip_)
@@ -880,6 +886,8 @@ TERMINATE:
 
 bool OsiCpxSolverInterface::setWarmStart(const CoinWarmStart *warmstart)
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
   debugMessage("OsiCpxSolverInterface::setWarmStart(%p)\n", (void *)warmstart);
 
   const CoinWarmStartBasis *ws = dynamic_cast< const CoinWarmStartBasis * >(warmstart);
@@ -982,6 +990,8 @@ void OsiCpxSolverInterface::markHotStart()
 
 void OsiCpxSolverInterface::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
   debugMessage("OsiCpxSolverInterface::solveFromHotStart()\n");
 
   int err;
@@ -1223,6 +1233,8 @@ bool OsiCpxSolverInterface::isContinuous(int colNumber) const
 
 const CoinPackedMatrix *OsiCpxSolverInterface::getMatrixByRow() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+  OSI_TRACE_SCOPE("getMatrixByRow");
   debugMessage("OsiCpxSolverInterface::getMatrixByRow()\n");
 
   if (matrixByRow_ == NULL) {
@@ -1267,6 +1279,8 @@ const CoinPackedMatrix *OsiCpxSolverInterface::getMatrixByRow() const
 
 const CoinPackedMatrix *OsiCpxSolverInterface::getMatrixByCol() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+  OSI_TRACE_SCOPE("getMatrixByCol");
   debugMessage("OsiCpxSolverInterface::getMatrixByCol()\n");
 
   if (matrixByCol_ == NULL) {
@@ -2286,6 +2300,8 @@ void OsiCpxSolverInterface::addRows(const int numrows,
   const CoinPackedVectorBase *const *rows,
   const double *rowlb, const double *rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   debugMessage("OsiCpxSolverInterface::addRows(%d, %p, %p, %p)\n", numrows, (void *)rows, (void *)rowlb, (void *)rowub);
 
   int i;
@@ -2299,6 +2315,8 @@ void OsiCpxSolverInterface::addRows(const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   debugMessage("OsiCpxSolverInterface::addRows(%d, %p, %p, %p, %p)\n", numrows, (void *)rows, (void *)rowsen, (void *)rowrhs, (void *)rowrng);
 
   int i;
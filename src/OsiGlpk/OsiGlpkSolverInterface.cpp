@@ -160,6 +160,8 @@ inline void checkGLPKerror(int err, std::string glpkfuncname,
 */
 void OGSI::initialSolve()
 {
+  OSI_STATISTICS_SCOPE(this, InitialSolve);
+  OSI_TRACE_SCOPE("initialSolve");
 #if OGSI_TRACK_FRESH > 0
   std::cout
     << "OGSI(" << std::hex << this << std::dec
@@ -269,6 +271,8 @@ void OGSI::initialSolve()
 
 void OGSI::resolve()
 {
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
 #if OGSI_TRACK_FRESH > 0
   std::cout
     << "OGSI(" << std::hex << this << std::dec
@@ -1051,6 +1055,8 @@ bool OGSI::isFeasible() const
 CoinWarmStart *OGSI::getWarmStart() const
 
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
   /*
   Create an empty basis and size it to the correct dimensions.
 */
@@ -1140,6 +1146,8 @@ CoinWarmStart *OGSI::getWarmStart() const
 bool OGSI::setWarmStart(const CoinWarmStart *warmstart)
 
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
   /*
   If this is a simple refresh request, we're done.
 */
@@ -1286,6 +1294,8 @@ void OGSI::markHotStart()
 
 void OGSI::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
 #if OGSI_TRACK_FRESH > 0
   std::cout
     << "OGSI(" << std::hex << this << std::dec
@@ -1324,6 +1334,133 @@ void OGSI::unmarkHotStart()
   // ??? be lazy with deallocating memory and do nothing here, deallocate memory in the destructor.
 }
 
+//#############################################################################
+// Tableau access
+//#############################################################################
+
+/*
+  GLPK writes row i as r<i> = a<i>x, so its logicals have coefficient -1
+  where Osi assumes +1. glp_eval_tab_row gives the basic variable x<k> as
+  sum alpha<j>x<N(j)>; written as x<k> - sum alpha<j>x<N(j)> = 0, the
+  coefficients of logicals change sign going to Osi, and the whole row
+  changes sign if x<k> is itself a logical so that its coefficient is +1.
+*/
+int OGSI::tableauRow(int row, int *index, double *element) const
+{
+  LPX *model = getMutableModelPtr();
+  if (!glp_bf_exists(model)) {
+    if (glp_factorize(model))
+      throw CoinError("Unable to factorize basis", "tableauRow",
+        "OsiGlpkSolverInterface");
+  }
+  int m = glp_get_num_rows(model);
+  int n = glp_get_num_cols(model);
+  int k = glp_get_bhead(model, row + 1);
+  // GLPK arrays start at 1 so use index and element from there
+  int len = glp_eval_tab_row(model, k, index, element);
+  double sign = (k <= m) ? -1.0 : 1.0;
+  for (int i = 1; i <= len; i++) {
+    int iGlpk = index[i];
+    if (iGlpk <= m) {
+      index[i - 1] = n + iGlpk - 1;
+      element[i - 1] = sign * element[i];
+    } else {
+      index[i - 1] = iGlpk - m - 1;
+      element[i - 1] = -sign * element[i];
+    }
+  }
+  // and basic variable
+  index[len] = (k <= m) ? n + k - 1 : k - m - 1;
+  element[len] = 1.0;
+  return len + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void OGSI::getBInvARow(int row, double *z, double *slack) const
+{
+  int n = getNumCols();
+  int m = getNumRows();
+  int *index = new int[n + 1];
+  double *element = new double[n + 1];
+  int len = tableauRow(row, index, element);
+  CoinZeroN(z, n);
+  if (slack)
+    CoinZeroN(slack, m);
+  for (int i = 0; i < len; i++) {
+    int iColumn = index[i];
+    if (iColumn < n)
+      z[iColumn] = element[i];
+    else if (slack)
+      slack[iColumn - n] = element[i];
+  }
+  delete[] index;
+  delete[] element;
+}
+
+//-----------------------------------------------------------------------------
+
+void OGSI::getBInvARows(int numberWanted, const int *rows,
+  CoinPackedMatrix &abar, CoinPackedMatrix *slack) const
+{
+  int n = getNumCols();
+  int m = getNumRows();
+  int *index = new int[n + 1];
+  double *element = new double[n + 1];
+  int *logicalIndex = new int[n + 1];
+  double *logicalElement = new double[n + 1];
+  abar = CoinPackedMatrix(false, 0.0, 0.0);
+  abar.setDimensions(0, n);
+  if (slack) {
+    *slack = CoinPackedMatrix(false, 0.0, 0.0);
+    slack->setDimensions(0, m);
+  }
+  for (int k = 0; k < numberWanted; k++) {
+    int len = tableauRow(rows[k], index, element);
+    // structurals packed in place, logicals to their own arrays
+    int nStructural = 0;
+    int nLogical = 0;
+    for (int i = 0; i < len; i++) {
+      int iColumn = index[i];
+      double value = element[i];
+      if (!value)
+        continue;
+      if (iColumn < n) {
+        index[nStructural] = iColumn;
+        element[nStructural++] = value;
+      } else {
+        logicalIndex[nLogical] = iColumn - n;
+        logicalElement[nLogical++] = value;
+      }
+    }
+    abar.appendRow(nStructural, index, element);
+    if (slack)
+      slack->appendRow(nLogical, logicalIndex, logicalElement);
+  }
+  delete[] index;
+  delete[] element;
+  delete[] logicalIndex;
+  delete[] logicalElement;
+}
+
+//-----------------------------------------------------------------------------
+
+void OGSI::getBasics(int *index) const
+{
+  LPX *model = getMutableModelPtr();
+  if (!glp_bf_exists(model)) {
+    if (glp_factorize(model))
+      throw CoinError("Unable to factorize basis", "getBasics",
+        "OsiGlpkSolverInterface");
+  }
+  int m = glp_get_num_rows(model);
+  int n = glp_get_num_cols(model);
+  for (int i = 0; i < m; i++) {
+    int k = glp_get_bhead(model, i + 1);
+    index[i] = (k <= m) ? n + k - 1 : k - m - 1;
+  }
+}
+
 //#############################################################################
 // Problem information methods (original data)
 //#############################################################################
@@ -1577,6 +1714,8 @@ bool OGSI::isContinuous(int colNumber) const
 
 const CoinPackedMatrix *OGSI::getMatrixByRow() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+  OSI_TRACE_SCOPE("getMatrixByRow");
   if (matrixByRow_ == NULL) {
     LPX *model = getMutableModelPtr();
 
@@ -1613,6 +1752,8 @@ const CoinPackedMatrix *OGSI::getMatrixByRow() const
 
 const CoinPackedMatrix *OGSI::getMatrixByCol() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+  OSI_TRACE_SCOPE("getMatrixByCol");
   if (matrixByCol_ == NULL) {
     LPX *model = getMutableModelPtr();
 
@@ -2135,6 +2276,7 @@ void OGSI::setColBounds(int j, double lower, double upper)
   if (colupper_) {
     colupper_[j] = upper;
   }
+  updateColumnType(j);
 
   return;
 }
@@ -2296,6 +2438,7 @@ void OGSI::setContinuous(int index)
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::FREECACHED_COLUMN);
   glp_set_col_kind(model, index + 1, GLP_CV);
+  updateColumnType(index);
 }
 
 //-----------------------------------------------------------------------------
@@ -2306,6 +2449,7 @@ void OGSI::setInteger(int index)
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::FREECACHED_COLUMN);
   glp_set_col_kind(model, index + 1, GLP_IV);
+  updateColumnType(index);
   /*
   Temporary hack to correct upper bounds on general integer variables.
   CoinMpsIO insists on forcing a bound of 1e30 for general integer variables
@@ -2571,6 +2715,8 @@ void OGSI::addRows(const int numrows,
   const CoinPackedVectorBase *const *rows,
   const double *rowlb, const double *rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   // ??? Could do this more efficiently now
   // Could be in OsiSolverInterfaceImpl.
   int i;
@@ -2585,6 +2731,8 @@ void OGSI::addRows(const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   // Could be in OsiSolverInterfaceImpl.
   int i;
   for (i = 0; i < numrows; ++i)
@@ -3186,6 +3334,7 @@ void OGSI::applyColCut(const OsiColCut &cc)
         type = GLP_FR;
 
       glp_set_col_bnds(getMutableModelPtr(), column + 1, type, lower, upper);
+      updateColumnType(column);
     }
   }
   // lower bounds
@@ -3208,6 +3357,7 @@ void OGSI::applyColCut(const OsiColCut &cc)
         type = GLP_FR;
 
       glp_set_col_bnds(getMutableModelPtr(), column + 1, type, lower, upper);
+      updateColumnType(column);
     }
   }
 #endif
@@ -3396,6 +3546,8 @@ void OGSI::gutsOfCopy(const OsiGlpkSolverInterface &source)
 
 void OGSI::gutsOfConstructor()
 {
+  // all changes to column kind and bounds go through updateColumnType
+  maintainColumnType_ = true;
   bbWasLast_ = 0;
   iter_used_ = 0;
   obj_ = NULL;
@@ -3605,6 +3757,9 @@ void OGSI::freeCachedData(int keepCached)
     freeCachedMatrix();
   if (!(keepCached & OGSI::KEEPCACHED_RESULTS))
     freeCachedResults();
+  // column set changed
+  if (!(keepCached & (OGSI::KEEPCACHED_COLUMN | OGSI::KEEPCACHED_MATRIX)))
+    freeColumnTypes();
 }
 
 //-----------------------------------------------------------------------------
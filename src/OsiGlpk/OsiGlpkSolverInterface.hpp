@@ -136,6 +136,24 @@ public:
   virtual void unmarkHotStart();
   //@}
 
+  //---------------------------------------------------------------------------
+  /**@name Tableau access (part of OsiSimplex group 1)
+
+     These use the GLPK basis factorization, which is computed if needed.
+     A valid basis must be present (e.g. after a successful solve).
+  */
+  //@{
+  /// Get a row of the tableau (slack part in slack if not NULL)
+  virtual void getBInvARow(int row, double *z, double *slack = NULL) const;
+
+  /// Get several rows of the tableau in sparse form
+  virtual void getBInvARows(int numberRows, const int *rows,
+    CoinPackedMatrix &abar, CoinPackedMatrix *slack = NULL) const;
+
+  /// Get indices of basic variables
+  virtual void getBasics(int *index) const;
+  //@}
+
   //---------------------------------------------------------------------------
   /**@name Problem information methods 
      
@@ -719,6 +737,14 @@ protected:
   /// Pointer to the model
   LPX *getMutableModelPtr() const;
 
+  /** Sparse tableau row for basis row \p row in Osi conventions.
+
+    Indices 0 ... n-1 are structurals and n ... n+m-1 logicals; the basic
+    variable of the row is included with coefficient 1. \p index and
+    \p element must have room for n+1 entries. Returns number of entries.
+  */
+  int tableauRow(int row, int *index, double *element) const;
+
   //@}
 
 private:
@@ -244,6 +244,8 @@ void OsiGrbSolverInterface::resizeAuxColIndSpace()
 
 void OsiGrbSolverInterface::initialSolve()
 {
+  OSI_STATISTICS_SCOPE(this, InitialSolve);
+  OSI_TRACE_SCOPE("initialSolve");
   debugMessage("OsiGrbSolverInterface::initialSolve()\n");
   bool takeHint;
   OsiHintStrength strength;
@@ -292,6 +294,8 @@ void OsiGrbSolverInterface::initialSolve()
 //-----------------------------------------------------------------------------
 void OsiGrbSolverInterface::resolve()
 {
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
   debugMessage("OsiGrbSolverInterface::resolve()\n");
   bool takeHint;
   OsiHintStrength strength;
@@ -703,6 +707,8 @@ static CompileTimeAssert< CoinWarmStartBasis::atLowerBound == 3 > UNUSED change_
 
 CoinWarmStart *OsiGrbSolverInterface::getWarmStart() const
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
   debugMessage("OsiGrbSolverInterface::getWarmStart()\n");
 
   assert(!probtypemip_);
@@ -789,6 +795,8 @@ CoinWarmStart *OsiGrbSolverInterface::getWarmStart() const
 
 bool OsiGrbSolverInterface::setWarmStart(const CoinWarmStart *warmstart)
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
   debugMessage("OsiGrbSolverInterface::setWarmStart(%p)\n", (void *)warmstart);
 
   const CoinWarmStartBasis *ws = dynamic_cast< const CoinWarmStartBasis * >(warmstart);
@@ -907,6 +915,8 @@ void OsiGrbSolverInterface::markHotStart()
 
 void OsiGrbSolverInterface::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
   debugMessage("OsiGrbSolverInterface::solveFromHotStart()\n");
 
   double maxiter;
@@ -1226,6 +1236,8 @@ bool OsiGrbSolverInterface::isContinuous(int colNumber) const
 
 const CoinPackedMatrix *OsiGrbSolverInterface::getMatrixByRow() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+  OSI_TRACE_SCOPE("getMatrixByRow");
   debugMessage("OsiGrbSolverInterface::getMatrixByRow()\n");
 
   if (matrixByRow_ == NULL) {
@@ -1290,6 +1302,8 @@ const CoinPackedMatrix *OsiGrbSolverInterface::getMatrixByRow() const
 
 const CoinPackedMatrix *OsiGrbSolverInterface::getMatrixByCol() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+  OSI_TRACE_SCOPE("getMatrixByCol");
   debugMessage("OsiGrbSolverInterface::getMatrixByCol()\n");
 
   if (matrixByCol_ == NULL) {
@@ -2348,6 +2362,8 @@ void OsiGrbSolverInterface::addRows(const int numrows,
   const CoinPackedVectorBase *const *rows,
   const double *rowlb, const double *rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   debugMessage("OsiGrbSolverInterface::addRows(%d, %p, %p, %p)\n", numrows, (void *)rows, (void *)rowlb, (void *)rowub);
 
   int i;
@@ -2423,6 +2439,8 @@ void OsiGrbSolverInterface::addRows(const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   debugMessage("OsiGrbSolverInterface::addRows(%d, %p, %p, %p, %p)\n", numrows, (void *)rows, (void *)rowsen, (void *)rowrhs, (void *)rowrng);
 
   int i;
@@ -3272,6 +3290,8 @@ OsiGrbSolverInterface &OsiGrbSolverInterface::operator=(const OsiGrbSolverInterf
 OsiSolverInterface::ApplyCutsReturnCode OsiGrbSolverInterface::applyCuts(const OsiCuts &cs,
   double effectivenessLb)
 {
+  OSI_STATISTICS_SCOPE(this, ApplyCuts);
+  OSI_TRACE_SCOPE("applyCuts");
   debugMessage("OsiGrbSolverInterface::applyCuts(%p)\n", (void *)&cs);
 
   OsiSolverInterface::ApplyCutsReturnCode retVal;
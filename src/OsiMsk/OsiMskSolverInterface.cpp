@@ -422,6 +422,8 @@ OsiMskSolverInterface::freeColType()
 
 void OsiMskSolverInterface::initialSolve()
 {
+  OSI_STATISTICS_SCOPE(this, InitialSolve);
+  OSI_TRACE_SCOPE("initialSolve");
   #if MSK_OSI_DEBUG_LEVEL > 1
   debugMessage("Begin OsiMskSolverInterface::initialSolve() %p\n", (void*)this);
   #endif
@@ -479,6 +481,8 @@ void OsiMskSolverInterface::initialSolve()
 
 void OsiMskSolverInterface::resolve()
 {
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
   #if MSK_OSI_DEBUG_LEVEL > 1
   debugMessage("Begin OsiMskSolverInterface::resolve %p\n", (void*)this);
   #endif
@@ -1236,6 +1240,8 @@ CoinWarmStart* OsiMskSolverInterface::getEmptyWarmStart () const
 
 CoinWarmStart* OsiMskSolverInterface::getWarmStart() const
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
 
   CoinWarmStartBasis* ws = NULL;
   int numbas = 0,numcols = getNumCols(),numrows = getNumRows(),*skx,*skc,
@@ -1478,6 +1484,8 @@ CoinWarmStart* OsiMskSolverInterface::getWarmStart() const
 
 bool OsiMskSolverInterface::setWarmStart(const CoinWarmStart* warmstart)
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
 
   const CoinWarmStartBasis* ws = dynamic_cast<const CoinWarmStartBasis*>(warmstart);
   int numcols, numrows, i, restat,numbas=0;
@@ -1769,6 +1777,8 @@ void OsiMskSolverInterface::markHotStart()
 
 void OsiMskSolverInterface::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
   #if MSK_OSI_DEBUG_LEVEL > 1
   debugMessage("Begin OsiMskSolverInterface::solveFromHotStart()\n");
   #endif
@@ -2331,6 +2341,8 @@ bool OsiMskSolverInterface::isContinuous( int colNumber ) const
 
 const CoinPackedMatrix * OsiMskSolverInterface::getMatrixByRow() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+  OSI_TRACE_SCOPE("getMatrixByRow");
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("Begin OsiMskSolverInterface::getMatrixByRow()\n");
   #endif
@@ -2405,6 +2417,8 @@ const CoinPackedMatrix * OsiMskSolverInterface::getMatrixByRow() const
 
 const CoinPackedMatrix * OsiMskSolverInterface::getMatrixByCol() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+  OSI_TRACE_SCOPE("getMatrixByCol");
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("Begin OsiMskSolverInterface::getMatrixByCol()\n");
   #endif
@@ -4118,6 +4132,8 @@ OsiMskSolverInterface::addRows(const int numrows,
                                  const CoinPackedVectorBase * const * rows,
                                  const double* rowlb, const double* rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("Begin OsiMskSolverInterface::addRows(%d, %p, %p, %p)\n", numrows, (void *)rows, (void *)rowlb, (void *)rowub);
   #endif
@@ -4162,6 +4178,8 @@ OsiMskSolverInterface::addRows(const int numrows,
                                  const char* rowsen, const double* rowrhs,   
                                  const double* rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   #if MSK_OSI_DEBUG_LEVEL > 3
   debugMessage("Begin OsiMskSolverInterface::addRows(%d, %p, %p, %p, %p)\n", numrows, (void *)rows, (void *)rowsen, (void *)rowrhs, (void *)rowrng);
   #endif
@@ -75,6 +75,8 @@ inline void throwSPXerror(std::string error, std::string osimethod)
 
 void OsiSpxSolverInterface::initialSolve()
 {
+  OSI_STATISTICS_SCOPE(this, InitialSolve);
+  OSI_TRACE_SCOPE("initialSolve");
   bool takeHint;
   OsiHintStrength strength;
 
@@ -129,6 +131,8 @@ void OsiSpxSolverInterface::initialSolve()
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::resolve()
 {
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
   bool takeHint;
   OsiHintStrength strength;
 
@@ -390,6 +394,8 @@ bool OsiSpxSolverInterface::isTimeLimitReached() const
 
 CoinWarmStart *OsiSpxSolverInterface::getWarmStart() const
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
   CoinWarmStartBasis *ws = NULL;
   int numcols = getNumCols();
   int numrows = getNumRows();
@@ -452,6 +458,8 @@ CoinWarmStart *OsiSpxSolverInterface::getWarmStart() const
 
 bool OsiSpxSolverInterface::setWarmStart(const CoinWarmStart *warmstart)
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
   const CoinWarmStartBasis *ws = dynamic_cast< const CoinWarmStartBasis * >(warmstart);
   int numcols, numrows, i;
   soplex::SPxSolver::VarStatus *cstat, *rstat;
@@ -550,13 +558,15 @@ void OsiSpxSolverInterface::markHotStart()
 
 void OsiSpxSolverInterface::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
   int maxiter;
 
   assert(getNumCols() <= hotStartCStatSize_);
   assert(getNumRows() <= hotStartRStatSize_);
 
-  // @todo why the hotstart basis is not set here ?????
-  //soplex_->setBasis(  reinterpret_cast<soplex::SPxSolver::VarStatus*>(hotStartRStat_),  reinterpret_cast<soplex::SPxSolver::VarStatus*>(hotStartCStat_) );
+  // every candidate starts from the basis saved by markHotStart()
+  soplex_->setBasis(reinterpret_cast< soplex::SPxSolver::VarStatus * >(hotStartRStat_), reinterpret_cast< soplex::SPxSolver::VarStatus * >(hotStartCStat_));
 
   maxiter = soplex_->terminationIter();
   soplex_->setTerminationIter(hotStartMaxIteration_);
@@ -588,18 +598,19 @@ int OsiSpxSolverInterface::getNumRows() const
 }
 int OsiSpxSolverInterface::getNumElements() const
 {
-#if 0
-  return soplex_->nNzos();
-#else
-  int retVal = 0;
-  int nrows = getNumRows();
-  int row;
-  for (row = 0; row < nrows; ++row) {
-    const soplex::SVector &rowvec = soplex_->rowVector(row);
-    retVal += rowvec.size();
+  // the count is cached with the matrix and kept up to date when rows or
+  // columns are added
+  if (numElements_ < 0) {
+    int retVal = 0;
+    int nrows = getNumRows();
+    int row;
+    for (row = 0; row < nrows; ++row) {
+      const soplex::SVector &rowvec = soplex_->rowVector(row);
+      retVal += rowvec.size();
+    }
+    numElements_ = retVal;
   }
-  return retVal;
-#endif
+  return numElements_;
 }
 
 //------------------------------------------------------------------
@@ -727,6 +738,8 @@ bool OsiSpxSolverInterface::isContinuous(int colNumber) const
 
 const CoinPackedMatrix *OsiSpxSolverInterface::getMatrixByRow() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+  OSI_TRACE_SCOPE("getMatrixByRow");
   if (matrixByRow_ == NULL) {
     int nrows = getNumRows();
     int ncols = getNumCols();
@@ -763,6 +776,8 @@ const CoinPackedMatrix *OsiSpxSolverInterface::getMatrixByRow() const
 
 const CoinPackedMatrix *OsiSpxSolverInterface::getMatrixByCol() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+  OSI_TRACE_SCOPE("getMatrixByCol");
   if (matrixByCol_ == NULL) {
     int nrows = getNumRows();
     int ncols = getNumCols();
@@ -1075,10 +1090,43 @@ void OsiSpxSolverInterface::addCol(const CoinPackedVectorBase &vec,
   const double obj)
 {
   soplex::DSVector colvec;
+  const int numElements = numElements_;
 
   colvec.add(vec.getNumElements(), vec.getIndices(), vec.getElements());
   soplex_->addCol(soplex::LPCol(obj, colvec, colub, collb));
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_ROW);
+  if (numElements >= 0)
+    numElements_ = numElements + colvec.size();
+}
+//-----------------------------------------------------------------------------
+void OsiSpxSolverInterface::addCols(const int numcols,
+  const CoinPackedVectorBase *const *cols,
+  const double *collb, const double *colub,
+  const double *obj)
+{
+  int col;
+  int nnz = 0;
+  const int numElements = numElements_;
+
+  for (col = 0; col < numcols; ++col)
+    nnz += cols[col]->getNumElements();
+
+  soplex::LPColSet colset(numcols, nnz);
+  soplex::DSVector colvec;
+
+  nnz = 0;
+  for (col = 0; col < numcols; ++col) {
+    const CoinPackedVectorBase &vec = *cols[col];
+    colvec.clear();
+    colvec.add(vec.getNumElements(), vec.getIndices(), vec.getElements());
+    colset.add(obj[col], collb[col], colvec, colub[col]);
+    nnz += colvec.size();
+  }
+
+  soplex_->addCols(colset);
+  freeCachedData(OsiSpxSolverInterface::KEEPCACHED_ROW);
+  if (numElements >= 0)
+    numElements_ = numElements + nnz;
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::deleteCols(const int num, const int *columnIndices)
@@ -1118,10 +1166,13 @@ void OsiSpxSolverInterface::addRow(const CoinPackedVectorBase &vec,
   const double rowlb, const double rowub)
 {
   soplex::DSVector rowvec;
+  const int numElements = numElements_;
 
   rowvec.add(vec.getNumElements(), vec.getIndices(), vec.getElements());
   soplex_->addRow(soplex::LPRow(rowlb, rowvec, rowub));
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_COLUMN);
+  if (numElements >= 0)
+    numElements_ = numElements + rowvec.size();
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::addRow(const CoinPackedVectorBase &vec,
@@ -1135,6 +1186,56 @@ void OsiSpxSolverInterface::addRow(const CoinPackedVectorBase &vec,
   addRow(vec, rowlb, rowub);
 }
 //-----------------------------------------------------------------------------
+void OsiSpxSolverInterface::addRows(const int numrows,
+  const CoinPackedVectorBase *const *rows,
+  const double *rowlb, const double *rowub)
+{
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
+  int row;
+  int nnz = 0;
+  const int numElements = numElements_;
+
+  for (row = 0; row < numrows; ++row)
+    nnz += rows[row]->getNumElements();
+
+  soplex::LPRowSet rowset(numrows, nnz);
+  soplex::DSVector rowvec;
+
+  nnz = 0;
+  for (row = 0; row < numrows; ++row) {
+    const CoinPackedVectorBase &vec = *rows[row];
+    rowvec.clear();
+    rowvec.add(vec.getNumElements(), vec.getIndices(), vec.getElements());
+    rowset.add(rowlb[row], rowvec, rowub[row]);
+    nnz += rowvec.size();
+  }
+
+  soplex_->addRows(rowset);
+  freeCachedData(OsiSpxSolverInterface::KEEPCACHED_COLUMN);
+  if (numElements >= 0)
+    numElements_ = numElements + nnz;
+}
+//-----------------------------------------------------------------------------
+void OsiSpxSolverInterface::addRows(const int numrows,
+  const CoinPackedVectorBase *const *rows,
+  const char *rowsen, const double *rowrhs,
+  const double *rowrng)
+{
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
+  double *rowlb = new double[numrows];
+  double *rowub = new double[numrows];
+  int row;
+
+  for (row = 0; row < numrows; ++row)
+    convertSenseToBound(rowsen[row], rowrhs[row], rowrng[row], rowlb[row], rowub[row]);
+  addRows(numrows, rows, rowlb, rowub);
+
+  delete[] rowlb;
+  delete[] rowub;
+}
+//-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::deleteRows(const int num, const int *rowIndices)
 {
   soplex_->removeRows(const_cast< int * >(rowIndices), num);
@@ -1517,6 +1618,7 @@ OsiSpxSolverInterface::OsiSpxSolverInterface()
   , rowact_(NULL)
   , matrixByRow_(NULL)
   , matrixByCol_(NULL)
+  , numElements_(-1)
 {
 #if SOPLEX_VERSION >= 220
 #ifndef NDEBUG
@@ -1572,6 +1674,7 @@ OsiSpxSolverInterface::OsiSpxSolverInterface(const OsiSpxSolverInterface &source
   , rowact_(NULL)
   , matrixByRow_(NULL)
   , matrixByCol_(NULL)
+  , numElements_(-1)
 {
   // Using the copy-constructor of SoPlex did not work, see #113
   *soplex_ = *source.soplex_;
@@ -1675,6 +1778,7 @@ void OsiSpxSolverInterface::freeCachedMatrix()
   freeCacheMatrix(matrixByCol_);
   assert(matrixByRow_ == NULL);
   assert(matrixByCol_ == NULL);
+  numElements_ = -1;
 }
 
 void OsiSpxSolverInterface::freeCachedResults()
@@ -440,13 +440,12 @@ public:
     const double collb, const double colub,
     const double obj);
 
-#if 0 // we are using the default implementation of OsiSolverInterface
-      /** */
-      virtual void addCols(const int numcols,
-			   const CoinPackedVectorBase * const * cols,
-			   const double* collb, const double* colub,   
-			   const double* obj);
-#endif
+  using OsiSolverInterface::addCols;
+  /** Add several columns through one SoPlex LPColSet */
+  virtual void addCols(const int numcols,
+    const CoinPackedVectorBase *const *cols,
+    const double *collb, const double *colub,
+    const double *obj);
 
   /** */
   virtual void deleteCols(const int num, const int *colIndices);
@@ -459,17 +458,16 @@ public:
     const char rowsen, const double rowrhs,
     const double rowrng);
 
-#if 0 // we are using the default implementation of OsiSolverInterface
-      /** */
-      virtual void addRows(const int numrows,
-			   const CoinPackedVectorBase * const * rows,
-			   const double* rowlb, const double* rowub);
-      /** */
-      virtual void addRows(const int numrows,
-			   const CoinPackedVectorBase * const * rows,
-    			   const char* rowsen, const double* rowrhs,   
-    			   const double* rowrng);
-#endif
+  using OsiSolverInterface::addRows;
+  /** Add several rows through one SoPlex LPRowSet */
+  virtual void addRows(const int numrows,
+    const CoinPackedVectorBase *const *rows,
+    const double *rowlb, const double *rowub);
+  /** Add several rows through one SoPlex LPRowSet */
+  virtual void addRows(const int numrows,
+    const CoinPackedVectorBase *const *rows,
+    const char *rowsen, const double *rowrhs,
+    const double *rowrng);
 
   /** */
   virtual void deleteRows(const int num, const int *rowIndices);
@@ -730,6 +728,9 @@ private:
 
   /// Pointer to row-wise copy of problem matrix coefficients.
   mutable CoinPackedMatrix *matrixByCol_;
+
+  /// Number of nonzeros in the matrix (-1 if not known)
+  mutable int numElements_;
   //@}
   //@}
 };
@@ -69,6 +69,8 @@ static void reporterror(const char *fname, int iline, int ierr)
 
 void OsiXprSolverInterface::initialSolve()
 {
+  OSI_STATISTICS_SCOPE(this, InitialSolve);
+  OSI_TRACE_SCOPE("initialSolve");
 
   freeSolution();
 
@@ -90,6 +92,8 @@ void OsiXprSolverInterface::initialSolve()
 
 void OsiXprSolverInterface::resolve()
 {
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
 
   freeSolution();
 
@@ -369,6 +373,8 @@ CoinWarmStart *OsiXprSolverInterface::getEmptyWarmStart() const
 
 CoinWarmStart *OsiXprSolverInterface::getWarmStart() const
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
   int pstat, retstat;
 
   /* OPEN: what does this mean */
@@ -449,6 +455,8 @@ TERMINATE:
 
 bool OsiXprSolverInterface::setWarmStart(const CoinWarmStart *warmstart)
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
   const CoinWarmStartBasis *ws = dynamic_cast< const CoinWarmStartBasis * >(warmstart);
 
   if (!ws)
@@ -522,6 +530,8 @@ void OsiXprSolverInterface::markHotStart()
 
 void OsiXprSolverInterface::solveFromHotStart()
 {
+  OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+  OSI_TRACE_SCOPE("solveFromHotStart");
   // *FIXME* : do better... -LL
   OsiSolverInterface::solveFromHotStart();
 }
@@ -817,6 +827,8 @@ OsiXprSolverInterface::isFreeBinary( int colNumber ) const
 const CoinPackedMatrix *
 OsiXprSolverInterface::getMatrixByRow() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+  OSI_TRACE_SCOPE("getMatrixByRow");
   if (matrixByRow_ == NULL) {
     if (isDataLoaded()) {
 
@@ -853,6 +865,8 @@ OsiXprSolverInterface::getMatrixByRow() const
 const CoinPackedMatrix *
 OsiXprSolverInterface::getMatrixByCol() const
 {
+  OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+  OSI_TRACE_SCOPE("getMatrixByCol");
   if (matrixByCol_ == NULL) {
     matrixByCol_ = new CoinPackedMatrix(*getMatrixByRow());
     matrixByCol_->reverseOrdering();
@@ -1521,6 +1535,8 @@ void OsiXprSolverInterface::addRows(const int numrows,
   const CoinPackedVectorBase *const *rows,
   const double *rowlb, const double *rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   // *FIXME* : must write the method -LL
   throw CoinError("method is not yet written", "addRows",
     "OsiXprSolverInterface");
@@ -1531,6 +1547,8 @@ void OsiXprSolverInterface::addRows(const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   // *FIXME* : must write the method -LL
   throw CoinError("method is not yet written", "addRows",
     "OsiXprSolverInterface");
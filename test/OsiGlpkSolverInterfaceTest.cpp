@@ -627,6 +627,91 @@ void OsiGlpkSolverInterfaceUnitTest(const std::string & mpsDir, const std::strin
     OSIUNITTEST_ASSERT_ERROR(eq(objValue,2520.57), {}, "glpk", "add/delete columns: optimal value after deleting added column");
   }
 
+  // Test tableau access (getBasics, getBInvARow, getBInvARows)
+  {
+    OsiGlpkSolverInterface m;
+    std::string fn = mpsDir+"exmip1";
+    m.readMps(fn.c_str(),"mps");
+    m.initialSolve();
+    OSIUNITTEST_ASSERT_ERROR(m.isProvenOptimal(), {}, "glpk", "tableau access: solve exmip1");
+    int n = m.getNumCols();
+    int nr = m.getNumRows();
+    const CoinPackedMatrix *byCol = m.getMatrixByCol();
+    CoinAbsFltEq eq(1.0e-7);
+
+    int *basics = new int[nr];
+    m.getBasics(basics);
+    bool basicsOk = true;
+    char *isBasic = new char[n+nr];
+    CoinZeroN(isBasic, n+nr);
+    for (int i = 0; i < nr; i++) {
+      if (basics[i] < 0 || basics[i] >= n+nr || isBasic[basics[i]])
+        basicsOk = false;
+      else
+        isBasic[basics[i]] = 1;
+    }
+    delete [] isBasic;
+    OSIUNITTEST_ASSERT_ERROR(basicsOk, {}, "glpk", "tableau access: getBasics gives distinct variables");
+
+    /*
+      With +1 on the logicals the tableau is B^-1 [A I], so the row for basis
+      row i has 1 at basics[i] and 0 at the other basic variables, and its
+      structural part is its logical part (a row of B^-1) times A.
+    */
+    double *z = new double[n];
+    double *slack = new double[nr];
+    double *zA = new double[n];
+    int *rows = new int[nr];
+    CoinPackedMatrix abarByRow(false, 0.0, 0.0);
+    CoinPackedMatrix slackByRow(false, 0.0, 0.0);
+    abarByRow.setDimensions(0, n);
+    slackByRow.setDimensions(0, nr);
+    bool unitOk = true;
+    bool productOk = true;
+    for (int i = 0; i < nr; i++) {
+      rows[i] = i;
+      m.getBInvARow(i, z, slack);
+      for (int k = 0; basicsOk && k < nr; k++) {
+        int j = basics[k];
+        double value = (j < n) ? z[j] : slack[j-n];
+        if (!eq(value, (k == i) ? 1.0 : 0.0))
+          unitOk = false;
+      }
+      byCol->transposeTimes(slack, zA);
+      for (int j = 0; j < n; j++) {
+        if (!eq(z[j], zA[j]))
+          productOk = false;
+      }
+      CoinPackedVector row;
+      row.setFullNonZero(n, z);
+      abarByRow.appendRow(row);
+      row.setFullNonZero(nr, slack);
+      slackByRow.appendRow(row);
+    }
+    OSIUNITTEST_ASSERT_ERROR(unitOk, {}, "glpk", "tableau access: getBInvARow is unit on basic variables");
+    OSIUNITTEST_ASSERT_ERROR(productOk, {}, "glpk", "tableau access: getBInvARow structurals are B^-1 A");
+
+    CoinPackedMatrix abar;
+    CoinPackedMatrix abarSlack;
+    m.getBInvARows(nr, rows, abar, &abarSlack);
+    OSIUNITTEST_ASSERT_ERROR(abar.isEquivalent2(abarByRow), {}, "glpk", "tableau access: getBInvARows matches getBInvARow");
+    OSIUNITTEST_ASSERT_ERROR(abarSlack.isEquivalent2(slackByRow), {}, "glpk", "tableau access: getBInvARows slacks match getBInvARow");
+    // and a subset in another order
+    int twoRows[2] = { nr-1, 0 };
+    m.getBInvARows(2, twoRows, abar);
+    OSIUNITTEST_ASSERT_ERROR(abar.getNumRows() == 2 && abar.getNumCols() == n, {}, "glpk", "tableau access: getBInvARows subset size");
+    m.getBInvARow(nr-1, z);
+    CoinPackedVector lastRow;
+    lastRow.setFullNonZero(n, z);
+    OSIUNITTEST_ASSERT_ERROR(abar.getVector(0).isEquivalent(lastRow, eq), {}, "glpk", "tableau access: getBInvARows subset rows");
+
+    delete [] basics;
+    delete [] z;
+    delete [] slack;
+    delete [] zA;
+    delete [] rows;
+  }
+
 #if 0
   // ??? Simplex routines not adapted to OsiGlpk yet
 
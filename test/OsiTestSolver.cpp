@@ -8,8 +8,18 @@
 #include <string>
 #include <cmath>
 
+#include "OsiConfig.h"
 #include "OsiTestSolver.hpp"
 
+// The hooks only get threads of their own if Osi is built with threads
+// (and so linked with the thread library, see OsiConfig.h)
+#ifndef VOL_ASYNC_HOOKS
+#define VOL_ASYNC_HOOKS OSI_HAS_THREADS
+#endif
+#if VOL_ASYNC_HOOKS
+#include <thread>
+#endif
+
 //#############################################################################
 /// Usage: v=w; where w is a VOL_dvector
 VOL_dvector&
@@ -296,6 +306,10 @@ VOL_problem::read_params(const char* filename)
       } else if (ss.find("granularity") == 0) {
 	 size_t i = ss.find("=");  
 	 parm.granularity = atof(&s[i+1]);
+
+      } else if (ss.find("async_hooks") == 0) {
+	 size_t i = ss.find("=");  
+	 parm.async_hooks = atoi(&s[i+1]);
       }
    }
    fclose(infile);
@@ -328,14 +342,129 @@ VOL_problem::set_default_parm()
    parm.redtestinvl = 10;
    parm.alphaint = 80;
    parm.temp_dualfile = 0;
+   parm.async_hooks = 0;
 }
    
+//######################################################################
+/// write the dual solution u to filename
+static void
+write_dual_file(const char* filename, const VOL_dvector& u)
+{
+   FILE* outfile = fopen(filename, "w");
+   if (!outfile)
+      return;
+   const int m = u.size();
+   for (int i = 0; i < m; ++i) {
+      fprintf(outfile, "%i %f\n", i+1, u[i]);
+   }
+   fclose(outfile);
+}
+
+//######################################################################
+/** Runs the primal heuristic and the dual checkpoint off the main loop
+    (see VOL_parms::async_hooks). Each job works on its own copy of the
+    vector. Without thread support the job is run when it is started but
+    its result is still only handed back by the matching finish call.
+*/
+class VOL_async_jobs {
+private:
+   VOL_user_hooks& hooks;
+   const VOL_problem& problem;
+   VOL_dvector heur_x;
+   double heur_ub;
+   int heur_retval;
+   bool heur_pending;
+   VOL_dvector dual_u;
+   const char* dual_file;
+#if VOL_ASYNC_HOOKS
+   std::thread heur_thread;
+   std::thread dual_thread;
+#endif
+   VOL_async_jobs(const VOL_async_jobs&);
+   VOL_async_jobs& operator=(const VOL_async_jobs&);
+
+   void run_heuristic() {
+      heur_ub = COIN_DBL_MAX;
+      heur_retval = hooks.heuristics(problem, heur_x, heur_ub);
+   }
+   void run_checkpoint() {
+      write_dual_file(dual_file, dual_u);
+   }
+
+public:
+   VOL_async_jobs(VOL_user_hooks& h, const VOL_problem& p) :
+      hooks(h), problem(p), heur_ub(COIN_DBL_MAX), heur_retval(0),
+      heur_pending(false), dual_file(0) {}
+   ~VOL_async_jobs() {
+      double ub = COIN_DBL_MAX;
+      finish_heuristic(ub);
+      finish_checkpoint();
+   }
+   /** start the heuristic on a copy of x */
+   void start_heuristic(const VOL_dvector& x) {
+      heur_x = x;
+      heur_pending = true;
+#if VOL_ASYNC_HOOKS
+      heur_thread = std::thread(&VOL_async_jobs::run_heuristic, this);
+#else
+      run_heuristic();
+#endif
+   }
+   /** wait for the heuristic (if any), lower best_ub by its value and
+       return its return code */
+   int finish_heuristic(double& best_ub) {
+      if (!heur_pending)
+	 return 0;
+#if VOL_ASYNC_HOOKS
+      heur_thread.join();
+#endif
+      heur_pending = false;
+      if (heur_ub < best_ub)
+	 best_ub = heur_ub;
+      return heur_retval;
+   }
+   /** save a copy of u to filename */
+   void start_checkpoint(const char* filename, const VOL_dvector& u) {
+      finish_checkpoint();
+      dual_file = filename;
+      dual_u = u;
+#if VOL_ASYNC_HOOKS
+      dual_thread = std::thread(&VOL_async_jobs::run_checkpoint, this);
+#else
+      run_checkpoint();
+#endif
+   }
+   /** wait until the last checkpoint is written */
+   void finish_checkpoint() {
+#if VOL_ASYNC_HOOKS
+      if (dual_thread.joinable())
+	 dual_thread.join();
+#endif
+   }
+};
+
+//######################################################################
+
+VOL_run::VOL_run(VOL_user_hooks& hooks, const VOL_problem& p) :
+   rc(p.psize), dual(p.dsize), dstar(p.dsize), dlast(p.dsize),
+   primal(p.psize, p.dsize), pstar(p.psize, p.dsize),
+   target(0.0), best_ub(COIN_DBL_MAX), retval(0),
+   lcost_sequence(0), ascent_first_check(0),
+   jobs(new VOL_async_jobs(hooks, p)) {}
+
+VOL_run::~VOL_run()
+{
+   delete jobs;
+   delete[] lcost_sequence;
+}
+
 //#############################################################################
 
 VOL_problem::VOL_problem() : 
    alpha_(-1),
    lambda_(-1),
    iter_(0),
+   run_(0),
    value(-1),
    psize(-1),
    dsize(-1)
@@ -348,6 +477,7 @@ VOL_problem::VOL_problem(const char *filename) :
    alpha_(-1),
    lambda_(-1),
    iter_(0),
+   run_(0),
   value(-1),
     psize(-1),
    dsize(-1)
@@ -360,6 +490,7 @@ VOL_problem::VOL_problem(const char *filename) :
 
 VOL_problem::~VOL_problem()
 {
+   delete run_;
    delete[] parm.temp_dualfile;
 }
 
@@ -379,162 +510,265 @@ VOL_problem::print_info(const int iter,
 //######################################################################
 /// this is the Volume Algorithm
 int
-VOL_problem::solve(VOL_user_hooks& hooks, const bool use_preset_dual) 
+VOL_problem::solve(VOL_user_hooks& hooks, const bool use_preset_dual,
+		   const bool use_state) 
 {
+   if (start(hooks, use_preset_dual, use_state) < 0)
+      return -1;
+
+   VOL_run& r = *run_;
+   while (next_step()) {  // main iteration
+      // compute reduced costs
+      r.retval = hooks.compute_rc(r.dual.u, r.rc);
+      if (r.retval < 0)  break;
+      // solve relaxed problem
+      r.retval = hooks.solve_subproblem(r.dual.u, r.rc, r.dual.lcost,
+					r.primal.x, r.primal.v,
+					r.primal.value);
+      if (r.retval < 0)  break;
+      if (update(hooks))
+	 break;
+   }
+   return finish();
+}
+
+//######################################################################
+/// initialization and the first subproblem of the Volume Algorithm
+int
+VOL_problem::start(VOL_user_hooks& hooks, const bool use_preset_dual,
+		   const bool use_state) 
+{
+   delete run_;
+   run_ = 0;
 
    if (initialize(use_preset_dual) < 0) // initialize several parameters
       return -1;
 
-   double best_ub = parm.ubinit;      // upper bound
-   int retval = 0; 
+   // continue from the state of the last solve if requested
+   const bool warm = use_state && state.valid;
+   if (warm) {
+      alpha_ = state.alpha;
+      lambda_ = state.lambda;
+   }
 
-   VOL_dvector rc(psize); // reduced costs
+   run_ = new VOL_run(hooks, *this);
+   VOL_run& r = *run_;
+   r.best_ub = parm.ubinit;      // upper bound
 
-   VOL_dual dual(dsize); // dual vector
+   VOL_dual& dual = r.dual;
    dual.u = dsol;
+   VOL_primal& primal = r.primal;
 
-   VOL_primal primal(psize, dsize);  // primal vector
-
-   retval = hooks.compute_rc(dual.u, rc); // compute reduced costs
-   if (retval < 0)  return -1;
+   r.retval = hooks.compute_rc(dual.u, r.rc); // compute reduced costs
+   if (r.retval < 0) {
+      delete run_;
+      run_ = 0;
+      return -1;
+   }
    // solve relaxed problem
-   retval = hooks.solve_subproblem(dual.u, rc, dual.lcost,
-				   primal.x, primal.v, primal.value);
-   if (retval < 0)  return -1;
+   r.retval = hooks.solve_subproblem(dual.u, r.rc, dual.lcost,
+				     primal.x, primal.v, primal.value);
+   if (r.retval < 0) {
+      delete run_;
+      run_ = 0;
+      return -1;
+   }
    // set target for the lagrangian value
-   double target = readjust_target(-COIN_DBL_MAX/2, dual.lcost);
+   r.target = readjust_target(warm ? state.target : -COIN_DBL_MAX/2,
+			      dual.lcost);
    // find primal violation 
    primal.find_max_viol(dual_lb, dual_ub); // this may be left out for speed
 
-   VOL_primal pstar(primal); // set pstar=primal
+   VOL_primal& pstar = r.pstar;
+   pstar = primal; // set pstar=primal
+   if (warm && state.pstar_x.size() == psize &&
+       state.pstar_v.size() == dsize) {
+      pstar.value = state.pstar_value;
+      pstar.x = state.pstar_x;
+      pstar.v = state.pstar_v;
+   }
    pstar.find_max_viol(dual_lb, dual_ub); // set violation of pstar
    
-   dual.compute_xrc(pstar.x, primal.x, rc); // compute xrc
+   dual.compute_xrc(pstar.x, primal.x, r.rc); // compute xrc
 
    //
-   VOL_dual dstar(dual); // dstar is the best dual solution so far
-   VOL_dual dlast(dual); // set dlast=dual
+   r.dstar = dual; // dstar is the best dual solution so far
+   r.dlast = dual; // set dlast=dual
 
    iter_ = 0;
    if (parm.printflag)
      print_info(iter_, primal, pstar, dual);
 
-   VOL_swing swing;
-   VOL_alpha_factor alpha_factor;
+   if (warm) {
+      r.swing.lastgreeniter = state.lastgreeniter;
+      r.swing.lastyellowiter = state.lastyellowiter;
+      r.swing.lastrediter = state.lastrediter;
+      r.alpha_factor.lastvalue = state.alpha_lastvalue;
+   }
 
-   double * lcost_sequence = new double[parm.ascent_check_invl];
+   r.lcost_sequence = new double[parm.ascent_check_invl];
 
-   const int ascent_first_check = VolMax(parm.ascent_first_check,
-					 parm.ascent_check_invl);
+   r.ascent_first_check = VolMax(parm.ascent_first_check,
+				 parm.ascent_check_invl);
+   return 0;
+}
 
-   for (iter_ = 1; iter_ <= parm.maxsgriters; ++iter_) {  // main iteration
-      dlast = dual;
-      // take a dual step
-      dual.step(target, lambda_, dual_lb, dual_ub, pstar.v);
-      // compute reduced costs
-      retval = hooks.compute_rc(dual.u, rc);
-      if (retval < 0)  break;
-      // solve relaxed problem
-      retval = hooks.solve_subproblem(dual.u, rc, dual.lcost,
-				      primal.x, primal.v, primal.value);
-      if (retval < 0)  break;
-      // set the violation of primal
-      primal.find_max_viol(dual_lb, dual_ub); // this may be left out for speed
-      dual.compute_xrc(pstar.x, primal.x, rc); // compute xrc
-
-      if (dual.lcost > dstar.lcost) { 
-	dstar = dual; // update dstar
-      }
-      // check if target should be updated
-      target = readjust_target(target, dstar.lcost);
-      // compute inner product between the new subgradient and the
-      // last direction. This to decide among green, yellow, red
-      const double ascent = dual.ascent(primal.v, dlast.u);
-      // green, yellow, red
-      swing.cond(dlast, dual.lcost, ascent, iter_);
-      // change lambda if needed
-      lambda_ *= swing.lfactor(parm, lambda_, iter_);
-
-      if (iter_ % parm.alphaint == 0) { // change alpha if needed
-	 const double fact = alpha_factor.factor(parm, dstar.lcost, alpha_);
-	 if (fact != 1.0 && (parm.printflag & 2)) {
- 	    printf(" ------------decreasing alpha to %f\n", alpha_*fact);
-	 }
-	 alpha_ *= fact;
-      }
-      // convex combination with new primal vector
-      pstar.cc(power_heur(primal, pstar, dual), primal);
-      pstar.find_max_viol(dual_lb, dual_ub); // find maximum violation of pstar
+//######################################################################
+/// start the next iteration with a dual step
+bool
+VOL_problem::next_step()
+{
+   if (++iter_ > parm.maxsgriters)
+      return false;
+   VOL_run& r = *run_;
+   r.dlast = r.dual;
+   // take a dual step
+   r.dual.step(r.target, lambda_, dual_lb, dual_ub, r.pstar.v);
+   return true;
+}
 
-      if (swing.rd)
-	dual = dstar; // if there is no improvement reset dual=dstar
+//######################################################################
+/// the rest of the iteration once the subproblem is solved
+bool
+VOL_problem::update(VOL_user_hooks& hooks)
+{
+   VOL_run& r = *run_;
+   VOL_dual& dual = r.dual;
+   VOL_dual& dstar = r.dstar;
+   VOL_primal& primal = r.primal;
+   VOL_primal& pstar = r.pstar;
+   VOL_swing& swing = r.swing;
+
+   // set the violation of primal
+   primal.find_max_viol(dual_lb, dual_ub); // this may be left out for speed
+   dual.compute_xrc(pstar.x, primal.x, r.rc); // compute xrc
 
-      if ((iter_ % parm.printinvl == 0) && parm.printflag) { // printing iteration information
-	 print_info(iter_, primal, pstar, dual);
-	 swing.print();
+   if (dual.lcost > dstar.lcost) { 
+     dstar = dual; // update dstar
+   }
+   // check if target should be updated
+   r.target = readjust_target(r.target, dstar.lcost);
+   // compute inner product between the new subgradient and the
+   // last direction. This to decide among green, yellow, red
+   const double ascent = dual.ascent(primal.v, r.dlast.u);
+   // green, yellow, red
+   swing.cond(r.dlast, dual.lcost, ascent, iter_);
+   // change lambda if needed
+   lambda_ *= swing.lfactor(parm, lambda_, iter_);
+
+   if (iter_ % parm.alphaint == 0) { // change alpha if needed
+      const double fact = r.alpha_factor.factor(parm, dstar.lcost, alpha_);
+      if (fact != 1.0 && (parm.printflag & 2)) {
+	 printf(" ------------decreasing alpha to %f\n", alpha_*fact);
       }
+      alpha_ *= fact;
+   }
+   // convex combination with new primal vector
+   pstar.cc(power_heur(primal, pstar, dual), primal);
+   pstar.find_max_viol(dual_lb, dual_ub); // find maximum violation of pstar
 
-      if (iter_ % parm.heurinvl == 0) { // run primal heuristic
+   if (swing.rd)
+     dual = dstar; // if there is no improvement reset dual=dstar
+
+   if ((iter_ % parm.printinvl == 0) && parm.printflag) { // printing iteration information
+      print_info(iter_, primal, pstar, dual);
+      swing.print();
+   }
+
+   if (iter_ % parm.heurinvl == 0) { // run primal heuristic
+      if (parm.async_hooks) {
+	 // collect the run started heurinvl iterations ago, start the next
+	 r.retval = r.jobs->finish_heuristic(r.best_ub);
+	 if (r.retval < 0)  return true;
+	 r.jobs->start_heuristic(pstar.x);
+      } else {
 	 double ub = COIN_DBL_MAX;
-	 retval = hooks.heuristics(*this, pstar.x, ub);
-	 if (retval < 0)  break;
-	 if (ub < best_ub)
-	    best_ub = ub;
-      }
-      // save dual solution every 500 iterations
-      if (iter_ % 500 == 0 && parm.temp_dualfile != 0) {
-	 FILE* outfile = fopen(parm.temp_dualfile, "w");
-	 const VOL_dvector& u = dstar.u;
-	 const int m = u.size();
-	 for (int i = 0; i < m; ++i) {
-	    fprintf(outfile, "%i %f\n", i+1, u[i]);
-	 }
-	 fclose(outfile);
+	 r.retval = hooks.heuristics(*this, pstar.x, ub);
+	 if (r.retval < 0)  return true;
+	 if (ub < r.best_ub)
+	    r.best_ub = ub;
       }
+   }
+   // save dual solution every 500 iterations
+   if (iter_ % 500 == 0 && parm.temp_dualfile != 0) {
+      if (parm.async_hooks)
+	 r.jobs->start_checkpoint(parm.temp_dualfile, dstar.u);
+      else
+	 write_dual_file(parm.temp_dualfile, dstar.u);
+   }
 
-      // test terminating criteria
-      const bool primal_feas = 
-	(pstar.viol < parm.primal_abs_precision);
-      //const double gap = VolAbs(pstar.value - dstar.lcost); 
-      const double gap = pstar.value - dstar.lcost;
-      const bool small_gap = VolAbs(dstar.lcost) < 0.0001 ?
-	(gap < parm.gap_abs_precision) :
-	( (gap < parm.gap_abs_precision) || 
-	  (gap/VolAbs(dstar.lcost) < parm.gap_rel_precision) );
+   // test terminating criteria
+   const bool primal_feas = 
+     (pstar.viol < parm.primal_abs_precision);
+   //const double gap = VolAbs(pstar.value - dstar.lcost); 
+   const double gap = pstar.value - dstar.lcost;
+   const bool small_gap = VolAbs(dstar.lcost) < 0.0001 ?
+     (gap < parm.gap_abs_precision) :
+     ( (gap < parm.gap_abs_precision) || 
+       (gap/VolAbs(dstar.lcost) < parm.gap_rel_precision) );
       
-      // test optimality
-      if (primal_feas && small_gap){
-	if (parm.printflag) printf(" small lp gap \n");
-	break;
-      }
+   // test optimality
+   if (primal_feas && small_gap){
+     if (parm.printflag) printf(" small lp gap \n");
+     return true;
+   }
 
-      // test proving integer optimality
-      if (best_ub - dstar.lcost < parm.granularity){
-	if (parm.printflag) printf(" small ip gap \n");
-	break;
-      }
+   // test proving integer optimality
+   if (r.best_ub - dstar.lcost < parm.granularity){
+     if (parm.printflag) printf(" small ip gap \n");
+     return true;
+   }
 
-      // test for non-improvement
-      const int k = iter_ % parm.ascent_check_invl;
-      if (iter_ > ascent_first_check) {
-	 if (dstar.lcost - lcost_sequence[k] <
-	     VolAbs(lcost_sequence[k]) * parm.minimum_rel_ascent){
-	   if (parm.printflag) printf(" small improvement \n");
-	   break;
-	 }
+   // test for non-improvement
+   const int k = iter_ % parm.ascent_check_invl;
+   if (iter_ > r.ascent_first_check) {
+      if (dstar.lcost - r.lcost_sequence[k] <
+	  VolAbs(r.lcost_sequence[k]) * parm.minimum_rel_ascent){
+	if (parm.printflag) printf(" small improvement \n");
+	return true;
       }
-      lcost_sequence[k] = dstar.lcost;
    }
-   delete[] lcost_sequence;
+   r.lcost_sequence[k] = dstar.lcost;
+   return false;
+}
+
+//######################################################################
+/// set the results of the Volume Algorithm
+int
+VOL_problem::finish()
+{
+   VOL_run& r = *run_;
+   int retval = r.retval;
+   // last heuristic run (if any) still counts towards the upper bound
+   if (parm.async_hooks) {
+      const int heur_retval = r.jobs->finish_heuristic(r.best_ub);
+      if (heur_retval < 0)
+	 retval = heur_retval;
+   }
+   r.jobs->finish_checkpoint();
 
    if (parm.printflag)
-     print_info(iter_, primal, pstar, dual);
+     print_info(iter_, r.primal, r.pstar, r.dual);
    // set solution to return
-   value = dstar.lcost;
-   psol = pstar.x;
-   dsol = dstar.u;
-   viol = pstar.v;
-
+   value = r.dstar.lcost;
+   psol = r.pstar.x;
+   dsol = r.dstar.u;
+   viol = r.pstar.v;
+   // save the state for a warm started solve
+   state.valid = true;
+   state.alpha = alpha_;
+   state.lambda = lambda_;
+   state.target = r.target;
+   state.alpha_lastvalue = r.alpha_factor.lastvalue;
+   state.lastgreeniter = r.swing.lastgreeniter - iter_;
+   state.lastyellowiter = r.swing.lastyellowiter - iter_;
+   state.lastrediter = r.swing.lastrediter - iter_;
+   state.pstar_value = r.pstar.value;
+   state.pstar_x = r.pstar.x;
+   state.pstar_v = r.pstar.v;
+
+   delete run_;
+   run_ = 0;
    return retval;
 }
 
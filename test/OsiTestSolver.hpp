@@ -59,6 +59,9 @@ class VOL_ivector;
 class VOL_primal;
 class VOL_dual;
 class VOL_swing;
+class VOL_state;
+class VOL_run;
+class VOL_async_jobs;
 class VOL_alpha_factor;
 class VOL_vh;
 class VOL_indc;
@@ -135,6 +138,17 @@ struct VOL_parms {
 
    /** name of file for saving dual solution */
    char* temp_dualfile;
+
+   /** if nonzero the primal heuristic and the saving of the dual solution
+       run on a worker thread (when compiled with <code>VOL_ASYNC_HOOKS</code>)
+       working on copies of the vectors. A heuristic started at iteration k
+       is collected at iteration k + <code>heurinvl</code> (or when the loop
+       ends) whether threads are used or not, so the run is reproducible.
+       The heuristic hook must then not look at the changing state of the
+       <code>VOL_problem</code> it is passed.
+       Default: 0
+   */
+   int async_hooks;
 };
 
 //############################################################################
@@ -385,6 +399,48 @@ public:
 
 };
 
+//############################################################################
+/** The state of the Volume Algorithm at the end of a solve. Handing it back
+    to the next solve (see <code>VOL_problem::solve</code>) lets a re-solve
+    after a small change of the problem continue with the step size, alpha,
+    target and primal average reached so far instead of starting over. The
+    iterations of the swing history are stored relative to the last
+    iteration (i.e., they are not positive). */
+class VOL_state {
+public:
+   /** whether a solve has filled in this state */
+   bool valid;
+   /** value of alpha */
+   double alpha;
+   /** value of lambda (the step size) */
+   double lambda;
+   /** target for the lagrangian value */
+   double target;
+   /** lagrangian value at the last check whether alpha should decrease */
+   double alpha_lastvalue;
+   /** last green, yellow and red iterations */
+   int lastgreeniter, lastyellowiter, lastrediter;
+   /** objective value of the primal average */
+   double pstar_value;
+   /** the primal average */
+   VOL_dvector pstar_x;
+   /** violations of the primal average */
+   VOL_dvector pstar_v;
+
+   VOL_state() :
+      valid(false), alpha(0.0), lambda(0.0), target(0.0),
+      alpha_lastvalue(0.0), lastgreeniter(0), lastyellowiter(0),
+      lastrediter(0), pstar_value(0.0) {}
+   ~VOL_state() {}
+
+   /** Forget the state. The next solve starts from scratch. */
+   inline void clear() {
+      valid = false;
+      pstar_x.clear();
+      pstar_v.clear();
+   }
+};
+
 
 //############################################################################
 /* here we check whether an iteration is green, yellow or red. Also according
@@ -596,6 +652,39 @@ public:
 
 //#############################################################################
 
+/** The data of a solve in progress, from <code>VOL_problem::start</code> to
+    <code>VOL_problem::finish</code>. */
+class VOL_run {
+private:
+   VOL_run(const VOL_run&);
+   VOL_run& operator=(const VOL_run&);
+public:
+   /** reduced costs of the current dual */
+   VOL_dvector rc;
+   /** the current, the best and the previous dual solution */
+   VOL_dual dual, dstar, dlast;
+   /** the current subproblem solution and the primal average */
+   VOL_primal primal, pstar;
+   /** target for the lagrangian value */
+   double target;
+   /** best upper bound found by the heuristic */
+   double best_ub;
+   /** return value of the last hook */
+   int retval;
+   VOL_swing swing;
+   VOL_alpha_factor alpha_factor;
+   /** best lagrangian values of the last ascent_check_invl iterations */
+   double * lcost_sequence;
+   int ascent_first_check;
+   /** heuristic and checkpoint runs (see VOL_parms::async_hooks) */
+   VOL_async_jobs* jobs;
+
+   VOL_run(VOL_user_hooks& hooks, const VOL_problem& p);
+   ~VOL_run();
+};
+
+//#############################################################################
+
 /** This class holds every data for the Volume Algorithm and its 
     <code>solve</code> method must be invoked to solve the problem.
 
@@ -626,8 +715,38 @@ public:
    //@{
    /** Solve the problem using the <code>hooks</code>. Any information needed 
        in the hooks must be stored in the structure <code>user_data</code> 
-       points to. */
-   int solve(VOL_user_hooks& hooks, const bool use_preset_dual = false);
+       points to. If <code>use_state</code> is true and <code>state</code>
+       holds the result of an earlier solve, the algorithm continues from
+       that state (the primal average only if the sizes still match). */
+   int solve(VOL_user_hooks& hooks, const bool use_preset_dual = false,
+	     const bool use_state = false);
+   //@}
+
+   /**@name Methods to run the algorithm one iteration at a time.
+      <code>solve</code> is <code>start</code>, then as long as
+      <code>next_step</code> returns true the work of the
+      <code>compute_rc</code> and <code>solve_subproblem</code> hooks on the
+      vectors of <code>run()</code> followed by <code>update</code> (until it
+      returns true), and finally <code>finish</code>. This way several
+      problems can be run in lockstep with their subproblems computed
+      together. */
+   //@{
+   /** Initialize and solve the first subproblem. Returns -1 on error. */
+   int start(VOL_user_hooks& hooks, const bool use_preset_dual = false,
+	     const bool use_state = false);
+   /** Take the dual step of the next iteration. Returns false if the
+       iteration limit is reached. */
+   bool next_step();
+   /** Finish the iteration after <code>run().rc</code>,
+       <code>run().dual.lcost</code> and <code>run().primal</code> are set for
+       the new dual <code>run().dual.u</code>. Returns true if the algorithm
+       should stop. */
+   bool update(VOL_user_hooks& hooks);
+   /** Set the results (same as the end of <code>solve</code>) and return
+       the return value of the last hook. */
+   int finish();
+   /** The data of the solve in progress */
+   VOL_run& run() { return *run_; }
    //@}
 
 private: 
@@ -644,6 +763,9 @@ private:
       int iter_;
       double __pad0;
    };
+   /** the solve in progress (between <code>start</code> and
+       <code>finish</code>) */
+   VOL_run* run_;
    //@}
 
 public:
@@ -658,6 +780,9 @@ public:
    VOL_dvector psol;
    /** violations (b-Ax) for the relaxed constraints */
    VOL_dvector viol;
+   /** state of the algorithm at the end of the solve (OUTPUT); used by the
+       next solve if requested (INPUT) */
+   VOL_state state;
    //@}
 
    /**@name External data (may be changed by the user before calling solve) */
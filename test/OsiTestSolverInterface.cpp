@@ -40,6 +40,30 @@ OsiTestSolverInterface::updateColMatrix_() const
    }
 }
 
+void
+OsiTestSolverInterface::updateZeroOneMinusOne_()
+{
+   if (zeroOneMinusOneCurrent_)
+      return;
+   isZeroOneMinusOne_ = test_zero_one_minusone_(colMatrix_);
+   if (isZeroOneMinusOne_) {
+      colMatrixOneMinusOne_ = new OsiVolMatrixOneMinusOne_(colMatrix_);
+      rowMatrixOneMinusOne_ = new OsiVolMatrixOneMinusOne_(rowMatrix_);
+   }
+   zeroOneMinusOneCurrent_ = true;
+}
+
+void
+OsiTestSolverInterface::freeZeroOneMinusOne_()
+{
+   delete colMatrixOneMinusOne_;
+   colMatrixOneMinusOne_ = NULL;
+   delete rowMatrixOneMinusOne_;
+   rowMatrixOneMinusOne_ = NULL;
+   isZeroOneMinusOne_ = false;
+   zeroOneMinusOneCurrent_ = false;
+}
+
 //-----------------------------------------------------------------------------
 
 void
@@ -71,12 +95,47 @@ OsiTestSolverInterface::compute_rc_(const double* u, double* rc) const
   } else {
     rowMatrix_.transposeTimes(u, rc);
   }
+  finish_rc_(objcoeffs_, rc);
+}
+
+//-----------------------------------------------------------------------------
 
+void
+OsiTestSolverInterface::finish_rc_(const double* c, double* rc) const
+{
   const int psize = getNumCols();
-  std::transform(rc, rc+psize, objcoeffs_, rc, std::minus<double>());
+  std::transform(rc, rc+psize, c, rc, std::minus<double>());
   std::transform(rc, rc+psize, rc, std::negate<double>());
 }
 
+//-----------------------------------------------------------------------------
+
+void
+OsiTestSolverInterface::solve_subproblem_(const double* c, const double* u,
+					  const double* rc, double* x,
+					  double& lcost, double& pcost) const
+{
+  const int psize = getNumCols();
+  const int dsize = getNumRows();
+  for (int i = 0; i < psize; ++i) {
+    x[i] = (rc[i] >= 0.0) ? collower_[i] : colupper_[i];
+  }
+
+  lcost = (std::inner_product(rhs_, rhs_ + dsize, u, 0.0) +
+	   std::inner_product(x, x + psize, rc, 0.0) );
+  pcost = std::inner_product(x, x + psize, c, 0.0);
+}
+
+//-----------------------------------------------------------------------------
+
+void
+OsiTestSolverInterface::finish_violation_(double* v) const
+{
+  const int dsize = getNumRows();
+  std::transform(v, v+dsize, rhs_, v, std::minus<double>());
+  std::transform(v, v+dsize, v, std::negate<double>());
+}
+
 //#############################################################################
 
 bool
@@ -124,16 +183,15 @@ OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m) {
       }
     }
   }
-  if (plusSize_ > 0) {
-    plusInd_ = new int[plusSize_];
-  }
-  if (minusSize_ > 0) {
-    minusInd_ = new int[minusSize_];
-  }
-  plusStart_ = new int[major];
-  plusLength_ = new int[major];
-  minusStart_ = new int[major];
-  minusLength_ = new int[major];
+
+  // one allocation for the indices and the starts/lengths of both signs
+  storage_ = new int[plusSize_ + minusSize_ + 4 * major];
+  plusInd_ = storage_;
+  minusInd_ = plusInd_ + plusSize_;
+  plusStart_ = minusInd_ + minusSize_;
+  plusLength_ = plusStart_ + major;
+  minusStart_ = plusLength_ + major;
+  minusLength_ = minusStart_ + major;
 
   plusSize_ = 0;
   minusSize_ = 0;
@@ -152,30 +210,13 @@ OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m) {
     plusLength_[i] = plusSize_ - plusStart_[i];
     minusLength_[i] = minusSize_ - minusStart_[i];
   }
-  if (plusSize_ == 0) {
-    delete[] plusStart_;    plusStart_  = NULL;
-    delete[] plusLength_;   plusLength_ = NULL;
-  }
-  if (minusSize_ == 0) {
-    delete[] minusStart_;    minusStart_  = NULL;
-    delete[] minusLength_;   minusLength_ = NULL;
-  }
 }
 
 //-----------------------------------------------------------------------------
 
 OsiTestSolverInterface::OsiVolMatrixOneMinusOne_::
 ~OsiVolMatrixOneMinusOne_() {
-  if (plusSize_ > 0) {
-    delete[] plusInd_;      plusInd_    = NULL;
-    delete[] plusStart_;    plusStart_  = NULL;
-    delete[] plusLength_;   plusLength_ = NULL;
-  }
-  if (minusSize_ > 0) {
-    delete[] minusInd_;      minusInd_    = NULL;
-    delete[] minusStart_;    minusStart_  = NULL;
-    delete[] minusLength_;   minusLength_ = NULL;
-  }
+  delete[] storage_;
 }
 
 //-----------------------------------------------------------------------------
@@ -225,6 +266,58 @@ timesMajor(const double* x, double* y) const
   }
 }
 
+//-----------------------------------------------------------------------------
+
+void OsiTestSolverInterface::OsiVolMatrixOneMinusOne_::
+timesMajorBlock(const double* x, double* y, const int k) const
+{
+  memset(y, 0, minorDim_ * k * sizeof(double));
+  for (int i = majorDim_ - 1; i >= 0; --i) {
+    const double* x_i = x + i * k;
+    int j, t;
+    const int* vecInd = plusInd_ + plusStart_[i];
+    for (j = plusLength_[i] - 1; j >= 0; --j) {
+      double* y_j = y + vecInd[j] * k;
+      for (t = 0; t < k; ++t)
+	y_j[t] += x_i[t];
+    }
+    vecInd = minusInd_ + minusStart_[i];
+    for (j = minusLength_[i] - 1; j >= 0; --j) {
+      double* y_j = y + vecInd[j] * k;
+      for (t = 0; t < k; ++t)
+	y_j[t] -= x_i[t];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+/* Same as OsiVolMatrixOneMinusOne_::timesMajorBlock for a general matrix:
+   y (minor dimension x k) = m * x (major dimension x k), both stored with the
+   k entries belonging to one index next to each other. */
+
+static void
+timesMajorBlock(const CoinPackedMatrix& m, const double* x, double* y,
+		const int k)
+{
+  const int major = m.getMajorDim();
+  const double* elem = m.getElements();
+  const int* ind = m.getIndices();
+  const int* start = m.getVectorStarts();
+  const int* length = m.getVectorLengths();
+
+  memset(y, 0, m.getMinorDim() * k * sizeof(double));
+  for (int i = major - 1; i >= 0; --i) {
+    const double* x_i = x + i * k;
+    const int last = start[i] + length[i];
+    for (int j = start[i]; j < last; ++j) {
+      const double val = elem[j];
+      double* y_j = y + ind[j] * k;
+      for (int t = 0; t < k; ++t)
+	y_j[t] += val * x_i[t];
+    }
+  }
+}
+
 //#############################################################################
 
 void
@@ -234,6 +327,7 @@ OsiTestSolverInterface::gutsOfDestructor_()
   colMatrix_.clear();
   rowMatrixCurrent_ = true;
   colMatrixCurrent_ = true;
+  freeZeroOneMinusOne_();
 
   delete[] colupper_;   colupper_ = 0;  
   delete[] collower_;	collower_ = 0;  
@@ -252,6 +346,8 @@ OsiTestSolverInterface::gutsOfDestructor_()
   delete[] lhs_;       	        lhs_ = 0;
 
   lagrangeanCost_ = 0.0;
+  volprob_.state.clear();
+  restoreVolState_ = false;
 
   maxNumrows_ = 0;
   maxNumcols_ = 0;
@@ -390,27 +486,14 @@ OsiTestSolverInterface::solve_subproblem(const VOL_dvector& dual,
 					VOL_dvector& x, VOL_dvector& v,
 					double& pcost)
 {
-  int i;
-
-  const int psize = x.size();
-  for (i = 0; i < psize; ++i) {
-    x[i] = (rc[i] >= 0.0) ? collower_[i] : colupper_[i];
-  }
-   
-  const int dsize = v.size();
-  lcost = (std::inner_product(rhs_, rhs_ + dsize, dual.v, 0.0) +
-	   std::inner_product(x.v, x.v + psize, rc.v, 0.0) );
+  solve_subproblem_(objcoeffs_, dual.v, rc.v, x.v, lcost, pcost);
 
   if (isZeroOneMinusOne_) {
     colMatrixOneMinusOne_->timesMajor(x.v, v.v);
   } else {
     colMatrix_.times(x.v, v.v);
   }
-
-  std::transform(v.v, v.v+dsize, rhs_, v.v, std::minus<double>());
-  std::transform(v.v, v.v+dsize, v.v, std::negate<double>());
-
-  pcost = std::inner_product(x.v, x.v + psize, objcoeffs_, 0.0);
+  finish_violation_(v.v);
 
   return 0;
 }
@@ -422,47 +505,40 @@ OsiTestSolverInterface::solve_subproblem(const VOL_dvector& dual,
 void 
 OsiTestSolverInterface::initialSolve()
 {
+   OSI_STATISTICS_SCOPE(this, InitialSolve);
+   OSI_TRACE_SCOPE("initialSolve");
    // set every entry to 0.0 in the dual solution
    CoinFillN(rowprice_, getNumRows(), 0.0);
+   // and start the volume algorithm from scratch
+   volprob_.state.clear();
+   restoreVolState_ = false;
    resolve();
 }
 
 //-----------------------------------------------------------------------------
 
-void 
-OsiTestSolverInterface::resolve()
+void
+OsiTestSolverInterface::setupVolProblem_(VOL_problem& volprob) const
 {
   int i;
-  
-  checkData_();
-
-  // Only one of these can do any work
-  updateRowMatrix_();
-  updateColMatrix_();
 
   const int dsize = getNumRows();
   const int psize = getNumCols();
 
-  // Negate the objective coefficients if necessary
-  if (objsense_ < 0) {
-    std::transform(objcoeffs_, objcoeffs_+psize, objcoeffs_,
-		   std::negate<double>());
-  }
-
   // Set the lb/ub on the duals
-  volprob_.dual_lb.allocate(dsize);
-  volprob_.dual_ub.allocate(dsize);
-  double * dlb = volprob_.dual_lb.v;
-  double * dub = volprob_.dual_ub.v;
+  volprob.dual_lb.allocate(dsize);
+  volprob.dual_ub.allocate(dsize);
+  double * dlb = volprob.dual_lb.v;
+  double * dub = volprob.dual_ub.v;
   for (i = 0; i < dsize; ++i) {
     dlb[i] = rowupper_[i] <  getInfinity() ? -1.0e31 : 0.0;
     dub[i] = rowlower_[i] > -getInfinity() ?  1.0e31 : 0.0;
   }
-  volprob_.dsize = dsize;
-  volprob_.psize = psize;
+  volprob.dsize = dsize;
+  volprob.psize = psize;
   
   // Set the dual starting point
-  VOL_dvector& dsol = volprob_.dsol;
+  VOL_dvector& dsol = volprob.dsol;
   dsol.allocate(dsize);
   std::transform(rowprice_, rowprice_+dsize, dsol.v,
 		 std::bind2nd(std::multiplies<double>(), objsense_));
@@ -476,19 +552,39 @@ OsiTestSolverInterface::resolve()
       dv[i] = dub[i];
     }
   }
+}
 
-  // If requested, check whether the matrix contains anything but 0/1/-1
-#if 0
-  isZeroOneMinusOne_ = false;
-#else
-  isZeroOneMinusOne_ = test_zero_one_minusone_(colMatrix_);
-  if (isZeroOneMinusOne_) {
-    colMatrixOneMinusOne_ = new OsiVolMatrixOneMinusOne_(colMatrix_);
-    rowMatrixOneMinusOne_ = new OsiVolMatrixOneMinusOne_(rowMatrix_);
+//-----------------------------------------------------------------------------
+
+void 
+OsiTestSolverInterface::resolve()
+{
+  OSI_STATISTICS_SCOPE(this, Resolve);
+  OSI_TRACE_SCOPE("resolve");
+  checkData_();
+
+  // Only one of these can do any work
+  updateRowMatrix_();
+  updateColMatrix_();
+
+  const int dsize = getNumRows();
+  const int psize = getNumCols();
+
+  // Negate the objective coefficients if necessary
+  if (objsense_ < 0) {
+    std::transform(objcoeffs_, objcoeffs_+psize, objcoeffs_,
+		   std::negate<double>());
   }
-#endif
 
-  volprob_.solve(*this, true);
+  // Set the dual bounds and starting point
+  setupVolProblem_(volprob_);
+
+  // Check whether the matrix contains anything but 0/1/-1 (the result is
+  // kept until the matrix changes)
+  updateZeroOneMinusOne_();
+
+  volprob_.solve(*this, true, volWarmStartMode_ || restoreVolState_);
+  restoreVolState_ = false;
 
   // extract the solution
 
@@ -518,13 +614,144 @@ OsiTestSolverInterface::resolve()
   } else {
     colMatrix_.times(colsol_, lhs_);
   }
+}
 
-  if (isZeroOneMinusOne_) {
-    delete colMatrixOneMinusOne_;
-    colMatrixOneMinusOne_ = NULL;
-    delete rowMatrixOneMinusOne_;
-    rowMatrixOneMinusOne_ = NULL;
+//-----------------------------------------------------------------------------
+
+void
+OsiTestSolverInterface::resolveBatch(const int k, const double* objectives,
+				     double* objValues, double* colSolutions,
+				     double* rowPrices)
+{
+  if (k <= 0)
+    return;
+
+  int i, j, t;
+
+  checkData_();
+
+  // Only one of these can do any work
+  updateRowMatrix_();
+  updateColMatrix_();
+  updateZeroOneMinusOne_();
+
+  const int dsize = getNumRows();
+  const int psize = getNumCols();
+
+  // The objectives in minimization form
+  double* obj = new double[k * psize];
+  for (i = k * psize - 1; i >= 0; --i)
+    obj[i] = objsense_ * objectives[i];
+
+  VOL_problem* volprobs = new VOL_problem[k];
+  bool* started = new bool[k];
+  int* active = new int[k];
+  int numActive = 0;
+
+  // The first subproblem of each run is solved through the hooks, with the
+  // objective of the run put in place of ours for the time being
+  double* objcoeffs = objcoeffs_;
+  for (j = 0; j < k; ++j) {
+    VOL_problem& volprob = volprobs[j];
+    volprob.parm = volprob_.parm;
+    volprob.parm.temp_dualfile = 0;
+    setupVolProblem_(volprob);
+    objcoeffs_ = obj + j * psize;
+    started[j] = volprob.start(*this, true) >= 0;
+    if (started[j])
+      active[numActive++] = j;
+  }
+  objcoeffs_ = objcoeffs;
+
+  // The iterations of the active runs go in lockstep. Their duals and
+  // subproblem solutions are gathered into dense blocks (the entries of one
+  // index next to each other) so that the reduced costs and the row
+  // activities of all of them take a single pass over the matrix.
+  double* ublock = new double[dsize * k];
+  double* rcblock = new double[psize * k];
+  double* xblock = new double[psize * k];
+  double* vblock = new double[dsize * k];
+  while (numActive > 0) {
+    // dual step; runs hitting the iteration limit drop out
+    int num = 0;
+    for (t = 0; t < numActive; ++t) {
+      if (volprobs[active[t]].next_step())
+	active[num++] = active[t];
+    }
+    numActive = num;
+    if (numActive == 0)
+      break;
+
+    for (t = 0; t < numActive; ++t) {
+      const double* u = volprobs[active[t]].run().dual.u.v;
+      for (i = 0; i < dsize; ++i)
+	ublock[i * numActive + t] = u[i];
+    }
+    if (isZeroOneMinusOne_) {
+      rowMatrixOneMinusOne_->timesMajorBlock(ublock, rcblock, numActive);
+    } else {
+      timesMajorBlock(rowMatrix_, ublock, rcblock, numActive);
+    }
+
+    // reduced costs and the subproblem solutions
+    for (t = 0; t < numActive; ++t) {
+      VOL_run& run = volprobs[active[t]].run();
+      const double* c = obj + active[t] * psize;
+      double* rc = run.rc.v;
+      double* x = run.primal.x.v;
+      for (i = 0; i < psize; ++i)
+	rc[i] = rcblock[i * numActive + t];
+      finish_rc_(c, rc);
+      solve_subproblem_(c, run.dual.u.v, rc, x, run.dual.lcost,
+			run.primal.value);
+      for (i = 0; i < psize; ++i)
+	xblock[i * numActive + t] = x[i];
+    }
+    if (isZeroOneMinusOne_) {
+      colMatrixOneMinusOne_->timesMajorBlock(xblock, vblock, numActive);
+    } else {
+      timesMajorBlock(colMatrix_, xblock, vblock, numActive);
+    }
+
+    // finish the iterations; runs that are done drop out
+    num = 0;
+    for (t = 0; t < numActive; ++t) {
+      VOL_problem& volprob = volprobs[active[t]];
+      double* v = volprob.run().primal.v.v;
+      for (i = 0; i < dsize; ++i)
+	v[i] = vblock[i * numActive + t];
+      finish_violation_(v);
+      if (! volprob.update(*this))
+	active[num++] = active[t];
+    }
+    numActive = num;
+  }
+  delete[] vblock;
+  delete[] xblock;
+  delete[] rcblock;
+  delete[] ublock;
+
+  // extract the solutions
+  for (j = 0; j < k; ++j) {
+    if (! started[j])
+      continue;
+    VOL_problem& volprob = volprobs[j];
+    volprob.finish();
+    if (objValues)
+      objValues[j] = objsense_ * volprob.value;
+    if (colSolutions)
+      CoinDisjointCopyN(volprob.psol.v, psize, colSolutions + j * psize);
+    if (rowPrices) {
+      std::transform(volprob.dsol.v, volprob.dsol.v + dsize,
+		     rowPrices + j * dsize,
+		     std::bind2nd(std::multiplies<double>(), objsense_));
+    }
   }
+
+  delete[] active;
+  delete[] started;
+  delete[] volprobs;
+  delete[] obj;
 }
 
 //#############################################################################
@@ -741,6 +968,10 @@ OsiTestSolverInterface::getEmptyWarmStart () const
 CoinWarmStart*
 OsiTestSolverInterface::getWarmStart() const
 {
+  OSI_STATISTICS_SCOPE(this, GetWarmStart);
+  OSI_TRACE_SCOPE("getWarmStart");
+  if (volWarmStartMode_ && volprob_.state.valid)
+    return new OsiTestWarmStart(getNumRows(), rowprice_, volprob_.state);
   return new CoinWarmStartDual(getNumRows(), rowprice_);
 }
 
@@ -749,6 +980,8 @@ OsiTestSolverInterface::getWarmStart() const
 bool
 OsiTestSolverInterface::setWarmStart(const CoinWarmStart* warmstart)
 {
+  OSI_STATISTICS_SCOPE(this, SetWarmStart);
+  OSI_TRACE_SCOPE("setWarmStart");
   const CoinWarmStartDual* ws =
     dynamic_cast<const CoinWarmStartDual*>(warmstart);
 
@@ -762,6 +995,15 @@ OsiTestSolverInterface::setWarmStart(const CoinWarmStart* warmstart)
   }
 
   CoinDisjointCopyN(ws->dual(), ws_size, rowprice_);
+
+  const OsiTestWarmStart* vws = dynamic_cast<const OsiTestWarmStart*>(ws);
+  if (vws) {
+    volprob_.state = vws->volState();
+    restoreVolState_ = true;
+  } else {
+    volprob_.state.clear();
+    restoreVolState_ = false;
+  }
   return true;
 }
 
@@ -780,6 +1022,8 @@ OsiTestSolverInterface::markHotStart()
 void
 OsiTestSolverInterface::solveFromHotStart()
 {
+   OSI_STATISTICS_SCOPE(this, SolveFromHotStart);
+   OSI_TRACE_SCOPE("solveFromHotStart");
    int itlimOrig = volprob_.parm.maxsgriters;
    getIntParam(OsiMaxNumIterationHotStart, volprob_.parm.maxsgriters);
    CoinDisjointCopyN(rowpriceHotStart_, getNumRows(), rowprice_);
@@ -810,6 +1054,8 @@ OsiTestSolverInterface::isContinuous(int colNumber) const
 
 const CoinPackedMatrix *
 OsiTestSolverInterface::getMatrixByRow() const {
+   OSI_STATISTICS_SCOPE(this, GetMatrixByRow);
+   OSI_TRACE_SCOPE("getMatrixByRow");
    updateRowMatrix_();
    return &rowMatrix_;
 }
@@ -818,6 +1064,8 @@ OsiTestSolverInterface::getMatrixByRow() const {
 
 const CoinPackedMatrix *
 OsiTestSolverInterface::getMatrixByCol() const {
+   OSI_STATISTICS_SCOPE(this, GetMatrixByCol);
+   OSI_TRACE_SCOPE("getMatrixByCol");
    updateColMatrix_();
    return &colMatrix_;
 }
@@ -1019,6 +1267,7 @@ OsiTestSolverInterface::addCol(const CoinPackedVectorBase& vec,
 
   updateColMatrix_();
   colMatrix_.appendCol(vec);
+  freeZeroOneMinusOne_();
   rowMatrixCurrent_ = false;
 }
 
@@ -1051,6 +1300,7 @@ OsiTestSolverInterface::addCols(const int numcols,
 
     updateColMatrix_();
     colMatrix_.appendCols(numcols, cols);
+    freeZeroOneMinusOne_();
     rowMatrixCurrent_ = false;
   }
 }
@@ -1083,6 +1333,7 @@ OsiTestSolverInterface::deleteCols(const int num, const int * columnIndices)
 
     updateColMatrix_();
     colMatrix_.deleteCols(delNum, delPos);
+    freeZeroOneMinusOne_();
     rowMatrixCurrent_ = false;
   }
 }
@@ -1105,6 +1356,7 @@ OsiTestSolverInterface::addRow(const CoinPackedVectorBase& vec,
 
   updateRowMatrix_();
   rowMatrix_.appendRow(vec);
+  freeZeroOneMinusOne_();
   colMatrixCurrent_ = false;
 }
 
@@ -1127,6 +1379,7 @@ OsiTestSolverInterface::addRow(const CoinPackedVectorBase& vec,
 
   updateRowMatrix_();
   rowMatrix_.appendRow(vec);
+  freeZeroOneMinusOne_();
   colMatrixCurrent_ = false;
 }
 
@@ -1137,6 +1390,8 @@ OsiTestSolverInterface::addRows(const int numrows,
 			       const CoinPackedVectorBase * const * rows,
 			       const double* rowlb, const double* rowub)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   if (numrows > 0) {
     const int rownum = getNumRows();
     rowRimResize_(rownum + numrows);
@@ -1151,6 +1406,7 @@ OsiTestSolverInterface::addRows(const int numrows,
 
     updateRowMatrix_();
     rowMatrix_.appendRows(numrows, rows);
+    freeZeroOneMinusOne_();
     colMatrixCurrent_ = false;
   }
 }
@@ -1163,6 +1419,8 @@ OsiTestSolverInterface::addRows(const int numrows,
 			       const char* rowsen, const double* rowrhs,   
 			       const double* rowrng)
 {
+  OSI_STATISTICS_SCOPE(this, AddRows);
+  OSI_TRACE_SCOPE("addRows");
   if (numrows > 0) {
     const int rownum = getNumRows();
     rowRimResize_(rownum + numrows);
@@ -1178,6 +1436,7 @@ OsiTestSolverInterface::addRows(const int numrows,
 
     updateRowMatrix_();
     rowMatrix_.appendRows(numrows, rows);
+    freeZeroOneMinusOne_();
     colMatrixCurrent_ = false;
   }
 }
@@ -1212,6 +1471,7 @@ OsiTestSolverInterface::deleteRows(const int num, const int * rowIndices)
 
     updateRowMatrix_();
     rowMatrix_.deleteRows(delNum, delPos);
+    freeZeroOneMinusOne_();
     colMatrixCurrent_ = false;
 
     delete[] delPos;
@@ -1227,7 +1487,10 @@ OsiTestSolverInterface::OsiTestSolverInterface () :
    rowMatrix_(),
    colMatrixCurrent_(true),
    colMatrix_(),
+   zeroOneMinusOneCurrent_(false),
    isZeroOneMinusOne_(false),
+   rowMatrixOneMinusOne_(NULL),
+   colMatrixOneMinusOne_(NULL),
 
    colupper_(0),
    collower_(0),
@@ -1252,7 +1515,9 @@ OsiTestSolverInterface::OsiTestSolverInterface () :
    maxNumrows_(0),
    maxNumcols_(0),
 
-   volprob_()
+   volprob_(),
+   volWarmStartMode_(false),
+   restoreVolState_(false)
 {
    volprob_.parm.granularity = 0.0;
 }
@@ -1274,7 +1539,10 @@ OsiTestSolverInterface::OsiTestSolverInterface(const OsiTestSolverInterface& x)
    rowMatrix_(),
    colMatrixCurrent_(true),
    colMatrix_(),
+   zeroOneMinusOneCurrent_(false),
    isZeroOneMinusOne_(false),
+   rowMatrixOneMinusOne_(NULL),
+   colMatrixOneMinusOne_(NULL),
 
    colupper_(0),
    collower_(0),
@@ -1299,7 +1567,9 @@ OsiTestSolverInterface::OsiTestSolverInterface(const OsiTestSolverInterface& x)
    maxNumrows_(0),
    maxNumcols_(0),
 
-   volprob_()
+   volprob_(),
+   volWarmStartMode_(false),
+   restoreVolState_(false)
 {
    operator=(x);
    volprob_.parm.granularity = 0.0;
@@ -1347,6 +1617,7 @@ OsiTestSolverInterface::operator=(const OsiTestSolverInterface& rhs)
       CoinDisjointCopyN(rhs.rc_, colnum, rc_);
    }
    volprob_.parm.granularity = 0.0;
+   volWarmStartMode_ = rhs.volWarmStartMode_;
    return *this;
 }
 
@@ -1376,6 +1647,7 @@ OsiTestSolverInterface::applyRowCut(const OsiRowCut& rc)
 
    updateRowMatrix_();
    rowMatrix_.appendRow(rc.row());
+   freeZeroOneMinusOne_();
    colMatrixCurrent_ = false;
 }
 
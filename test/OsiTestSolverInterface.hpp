@@ -12,6 +12,7 @@
 #include "OsiTestSolver.hpp"
 
 #include "CoinPackedMatrix.hpp"
+#include "CoinWarmStartDual.hpp"
 
 #include "OsiSolverInterface.hpp"
 
@@ -19,6 +20,29 @@ static const double OsiTestInfinity = 1.0e31;
 
 //#############################################################################
 
+/** Warm start for OsiTestSolverInterface in Volume warm start mode: the dual
+    solution together with the state of the Volume Algorithm. */
+class OsiTestWarmStart : public CoinWarmStartDual {
+public:
+  OsiTestWarmStart(int size, const double *dual, const VOL_state& state) :
+    CoinWarmStartDual(size, dual), state_(state) {}
+  virtual ~OsiTestWarmStart() {}
+
+  virtual CoinWarmStart *clone() const {
+    return new OsiTestWarmStart(*this);
+  }
+
+  /// The state of the Volume Algorithm
+  const VOL_state& volState() const { return state_; }
+
+private:
+  OsiTestWarmStart& operator=(const OsiTestWarmStart&);
+
+  VOL_state state_;
+};
+
+//#############################################################################
+
 /** Vol(ume) Solver Interface
 
     Instantiation of OsiTestSolverInterface for the Volume Algorithm
@@ -33,6 +57,9 @@ private:
     int majorDim_;
     int minorDim_;
 
+    /// The single block holding all the index arrays below
+    int * storage_;
+
     int plusSize_;
     int * plusInd_;
     int * plusStart_;
@@ -47,6 +74,9 @@ private:
     OsiVolMatrixOneMinusOne_(const CoinPackedMatrix& m);
     ~OsiVolMatrixOneMinusOne_();
     void timesMajor(const double* x, double* y) const;
+    /** y = M * x for k vectors at once; x (major dimension x k) and y (minor
+	dimension x k) hold the k entries of one index next to each other */
+    void timesMajorBlock(const double* x, double* y, const int k) const;
   };
 
 public:
@@ -59,6 +89,20 @@ public:
     /// Resolve an LP relaxation after problem modification
     virtual void resolve();
 
+    /** Solve the problem for <code>k</code> objective vectors at once. Each
+	is an independent run of the Volume Algorithm from the current dual
+	solution. The runs proceed in lockstep, so that each iteration does
+	the matrix-vector products of all of them in one pass over the
+	matrix. <code>objectives</code> holds the k objective vectors (in the
+	current objective sense) one after the other. The output arrays may
+	be NULL; otherwise <code>objValues</code> gets the k lagrangean
+	bounds, <code>colSolutions</code> and <code>rowPrices</code> the k
+	primal and dual solutions one after the other. The solution held by
+	the solver interface does not change. */
+    void resolveBatch(const int k, const double* objectives,
+		      double* objValues, double* colSolutions,
+		      double* rowPrices);
+
     /// Invoke solver's built-in enumeration algorithm
     virtual void branchAndBound() {
       throw CoinError("Sorry, the Volume Algorithm doesn't implement B&B",
@@ -126,11 +170,23 @@ public:
     */
     virtual CoinWarmStart *getEmptyWarmStart () const ;
 
-    /// Get warmstarting information
+    /** Get warmstarting information. In Volume warm start mode this is an
+	OsiTestWarmStart that also holds the state of the algorithm. */
     virtual CoinWarmStart* getWarmStart() const;
     /** Set warmstarting information. Return true/false depending on whether
-	the warmstart information was accepted or not. */
+	the warmstart information was accepted or not. An OsiTestWarmStart
+	makes the next resolve() continue from its algorithm state, any other
+	dual warm start makes it start the algorithm from scratch. */
     virtual bool setWarmStart(const CoinWarmStart* warmstart);
+
+    /** Switch Volume warm start mode on or off. When on, every resolve()
+	continues from the state (step size, alpha, target, primal average,
+	swing history) the previous solve ended with, so re-solves after a
+	small change such as a cut or a bound change need far fewer
+	iterations. initialSolve() always starts from scratch. Default: off */
+    void setVolWarmStartMode(bool on) { volWarmStartMode_ = on; }
+    /// Whether Volume warm start mode is on
+    bool getVolWarmStartMode() const { return volWarmStartMode_; }
   //@}
 
   //---------------------------------------------------------------------------
@@ -743,6 +799,15 @@ private:
     void updateRowMatrix_() const;
     /** Update the column ordered matrix from the row ordered one */
     void updateColMatrix_() const;
+    /** Classify the matrix as 0/1/-1 or not and build the element free
+	matrices, unless that was already done for the current matrix */
+    void updateZeroOneMinusOne_();
+    /** Drop the 0/1/-1 classification and matrices; must be called whenever
+	the problem matrix changes */
+    void freeZeroOneMinusOne_();
+    /** Set the sizes, the dual bounds and the dual starting point (from
+	the current row prices) of a volume problem */
+    void setupVolProblem_(VOL_problem& volprob) const;
 
     /** Test whether the Volume Algorithm can be applied to the given problem.
      */
@@ -750,6 +815,20 @@ private:
     /** Compute the reduced costs (<code>rc</code>) with respect to the dual
         values given in <code>u</code>. */
     void compute_rc_(const double* u, double* rc) const;
+    /** Turn the product of the duals and the matrix, given in
+	<code>rc</code>, into the reduced costs for the objective
+	<code>c</code>. */
+    void finish_rc_(const double* c, double* rc) const;
+    /** Solve the subproblem for the objective <code>c</code>, the duals
+	<code>u</code> and the reduced costs <code>rc</code>: set the primal
+	vector <code>x</code>, its lagrangean cost <code>lcost</code> and its
+	primal cost <code>pcost</code>. Shared by <code>solve_subproblem</code>
+	and <code>resolveBatch</code>. */
+    void solve_subproblem_(const double* c, const double* u, const double* rc,
+			   double* x, double& lcost, double& pcost) const;
+    /** Turn the row activities of the subproblem solution, given in
+	<code>v</code>, into the violation of the rows. */
+    void finish_violation_(double* v) const;
     /** A method deleting every member data */
     void gutsOfDestructor_();
 
@@ -795,6 +874,10 @@ private:
   //---------------------------------------------------------------------------
   /**@name Data members used when 0/1/-1 matrix is detected */
   //@{
+    /** An indicator whether <code>isZeroOneMinusOne_</code> and the two
+	matrices below reflect the current problem matrix. They are kept
+	across resolves and dropped whenever the matrix changes. */
+    bool zeroOneMinusOneCurrent_;
     /// An indicator whether the matrix is 0/1/-1
     bool isZeroOneMinusOne_;
     /// The row ordered matrix without the elements
@@ -858,6 +941,10 @@ private:
 
   /// The volume solver
   VOL_problem volprob_;
+  /// Whether resolve() continues from the last state of the volume solver
+  bool volWarmStartMode_;
+  /// Whether the next resolve() continues from a state set by setWarmStart()
+  bool restoreVolState_;
 };
 
 /** A function that tests the methods in the OsiTestSolverInterface class.  */
@@ -4,14 +4,266 @@
 
 #include "OsiTestSolverInterface.hpp"
 #include "OsiUnitTests.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinFloatEqual.hpp"
+#include "CoinPackedMatrix.hpp"
 
 //#############################################################################
 
+namespace {
+
+/* A small set covering problem (every row covered by a column, the
+   cheapest columns wanted) for the Volume Algorithm itself. Its
+   heuristic takes every column the primal vector uses at all and counts
+   how often it is called. */
+class CoverHooks : public VOL_user_hooks {
+public:
+  static const int psize = 4;
+  static const int dsize = 3;
+  int numHeuristics;
+
+  CoverHooks() : numHeuristics(0) {}
+
+  virtual int compute_rc(const VOL_dvector& u, VOL_dvector& rc) {
+    for (int j = 0; j < psize; ++j) {
+      rc[j] = cost(j);
+      for (int i = 0; i < dsize; ++i)
+	rc[j] -= u[i] * element(i, j);
+    }
+    return 0;
+  }
+  virtual int solve_subproblem(const VOL_dvector& dual, const VOL_dvector& rc,
+			       double& lcost, VOL_dvector& x, VOL_dvector& v,
+			       double& pcost) {
+    int i, j;
+    lcost = 0.0;
+    pcost = 0.0;
+    for (j = 0; j < psize; ++j) {
+      x[j] = rc[j] >= 0.0 ? 0.0 : 1.0;
+      lcost += rc[j] * x[j];
+      pcost += cost(j) * x[j];
+    }
+    for (i = 0; i < dsize; ++i) {
+      lcost += dual[i];
+      v[i] = 1.0;
+      for (j = 0; j < psize; ++j)
+	v[i] -= element(i, j) * x[j];
+    }
+    return 0;
+  }
+  virtual int heuristics(const VOL_problem& /*p*/,
+			 const VOL_dvector& x, double& heur_val) {
+    ++numHeuristics;
+    heur_val = 0.0;
+    for (int i = 0; i < dsize; ++i) {
+      bool covered = false;
+      for (int j = 0; j < psize; ++j) {
+	if (x[j] > 0.0 && element(i, j) != 0.0)
+	  covered = true;
+      }
+      if (! covered) {
+	heur_val = COIN_DBL_MAX;
+	return 0;
+      }
+    }
+    for (int j = 0; j < psize; ++j) {
+      if (x[j] > 0.0)
+	heur_val += cost(j);
+    }
+    return 0;
+  }
+
+private:
+  // column j covers rows j-1 and j
+  static double element(int i, int j) { return (i == j || i == j - 1) ? 1.0 : 0.0; }
+  static double cost(int j) { static const double c[] = { 3.0, 2.0, 4.0, 1.0 }; return c[j]; }
+};
+
+/* Solve the covering problem with the heuristic run inline or
+   asynchronously. */
+void solveCover(int async_hooks, CoverHooks& hooks, VOL_problem& volprob)
+{
+  volprob.psize = CoverHooks::psize;
+  volprob.dsize = CoverHooks::dsize;
+  volprob.dual_lb.allocate(CoverHooks::dsize);
+  volprob.dual_ub.allocate(CoverHooks::dsize);
+  for (int i = 0; i < CoverHooks::dsize; ++i) {
+    volprob.dual_lb[i] = 0.0;
+    volprob.dual_ub[i] = 1.0e31;
+  }
+  volprob.parm.printflag = 0;
+  volprob.parm.maxsgriters = 200;
+  volprob.parm.heurinvl = 5;
+  volprob.parm.async_hooks = async_hooks;
+  volprob.solve(hooks, false);
+}
+
+}
+
 //--------------------------------------------------------------------------
 void
 OsiTestSolverInterfaceUnitTest(const std::string & mpsDir, const std::string & netlibDir)
 {
 
+  // resolveBatch gives what one initialSolve per objective gives, with a
+  // 0/1/-1 matrix and with a general one
+  for (int general = 0; general < 2; ++general) {
+    const int numcols = 4;
+    const int numrows = 3;
+    const int k = 3;
+    int rowIndices[] = { 0, 0, 0, 0, 1, 1, 2, 2 };
+    int colIndices[] = { 0, 1, 2, 3, 0, 2, 1, 3 };
+    double elements[] = { 1.0, 1.0, 1.0, 1.0, 1.0, -1.0, 1.0, 1.0 };
+    if (general)
+      elements[5] = -2.0;
+    CoinPackedMatrix matrix(false, rowIndices, colIndices, elements, 8);
+    double collb[] = { 0.0, 0.0, 0.0, 0.0 };
+    double colub[] = { 1.0, 1.0, 1.0, 1.0 };
+    double rowlb[] = { 2.0, -1.0e30, 1.0 };
+    double rowub[] = { 1.0e30, 0.5, 1.0 };
+    double objectives[] = { 1.0, 2.0, 3.0, 4.0,
+			    -1.0, 1.0, -1.0, 1.0,
+			    2.0, -1.0, 0.0, 1.0 };
+
+    OsiTestSolverInterface m;
+    m.loadProblem(matrix, collb, colub, objectives, rowlb, rowub);
+
+    double objValues[k];
+    double colSolutions[k * numcols];
+    double rowPrices[k * numrows];
+    int i, j;
+    for (j = 0; j < k; ++j) {
+      for (i = 0; i < numcols; ++i)
+	m.setObjCoeff(i, objectives[j * numcols + i]);
+      m.initialSolve();
+      objValues[j] = m.getObjValue();
+      CoinDisjointCopyN(m.getColSolution(), numcols, colSolutions + j * numcols);
+      CoinDisjointCopyN(m.getRowPrice(), numrows, rowPrices + j * numrows);
+    }
+
+    // the runs start from zero duals, as initialSolve does
+    double zeros[numrows] = { 0.0, 0.0, 0.0 };
+    m.setRowPrice(zeros);
+    double batchValues[k];
+    double batchColSolutions[k * numcols];
+    double batchRowPrices[k * numrows];
+    m.resolveBatch(k, objectives, batchValues, batchColSolutions,
+		   batchRowPrices);
+
+    CoinRelFltEq eq(1.0e-8);
+    bool same = true;
+    for (j = 0; j < k; ++j) {
+      if (! eq(objValues[j], batchValues[j]))
+	same = false;
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "vol", "resolveBatch: objective values");
+    same = true;
+    for (i = 0; i < k * numcols; ++i) {
+      if (! eq(colSolutions[i], batchColSolutions[i]))
+	same = false;
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "vol", "resolveBatch: primal solutions");
+    same = true;
+    for (i = 0; i < k * numrows; ++i) {
+      if (! eq(rowPrices[i], batchRowPrices[i]))
+	same = false;
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "vol", "resolveBatch: dual solutions");
+  }
+
+  // With async_hooks the heuristic runs on a worker thread (if there are
+  // threads) on a copy of the primal vector; the run must be the same as
+  // with the heuristic run inline
+  {
+    CoverHooks inlineHooks;
+    CoverHooks asyncHooks;
+    VOL_problem inlineProb;
+    VOL_problem asyncProb;
+    solveCover(0, inlineHooks, inlineProb);
+    solveCover(1, asyncHooks, asyncProb);
+    OSIUNITTEST_ASSERT_ERROR(asyncHooks.numHeuristics > 0, {}, "vol", "async_hooks: heuristic called");
+    OSIUNITTEST_ASSERT_ERROR(asyncHooks.numHeuristics == inlineHooks.numHeuristics, {}, "vol", "async_hooks: heuristic called as often as inline");
+    OSIUNITTEST_ASSERT_ERROR(asyncProb.value == inlineProb.value, {}, "vol", "async_hooks: same lagrangean value");
+    bool same = true;
+    for (int i = 0; i < CoverHooks::dsize; ++i) {
+      if (asyncProb.dsol[i] != inlineProb.dsol[i])
+	same = false;
+    }
+    for (int j = 0; j < CoverHooks::psize; ++j) {
+      if (asyncProb.psol[j] != inlineProb.psol[j])
+	same = false;
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "vol", "async_hooks: same solution");
+    // the optimum covers with the columns of cost 2 and 1
+    OSIUNITTEST_ASSERT_ERROR(asyncProb.value <= 3.0 + 1.0e-6, {}, "vol", "async_hooks: valid bound");
+  }
+
+  // In Volume warm start mode a re-solve after a bound change continues
+  // from the state of the last solve, and getWarmStart/setWarmStart carry
+  // that state to another solver
+  {
+    // a covering problem: column j covers rows j, j+1 and j+3 (modulo
+    // the number of rows)
+    const int numcols = 30;
+    const int numrows = 20;
+    int rowIndices[3 * numcols];
+    int colIndices[3 * numcols];
+    double elements[3 * numcols];
+    double collb[numcols];
+    double colub[numcols];
+    double obj[numcols];
+    double rowlb[numrows];
+    double rowub[numrows];
+    int i, j;
+    for (j = 0; j < numcols; ++j) {
+      rowIndices[3 * j] = j % numrows;
+      rowIndices[3 * j + 1] = (j + 1) % numrows;
+      rowIndices[3 * j + 2] = (j + 3) % numrows;
+      for (i = 3 * j; i < 3 * j + 3; ++i) {
+	colIndices[i] = j;
+	elements[i] = 1.0;
+      }
+      collb[j] = 0.0;
+      colub[j] = 1.0;
+      obj[j] = 1.0 + (j * 7) % 5;
+    }
+    CoinPackedMatrix matrix(true, rowIndices, colIndices, elements,
+			    3 * numcols);
+
+    OsiTestSolverInterface m;
+    for (i = 0; i < numrows; ++i) {
+      rowlb[i] = 1.0;
+      rowub[i] = m.getInfinity();
+    }
+    m.loadProblem(matrix, collb, colub, obj, rowlb, rowub);
+    OSIUNITTEST_ASSERT_ERROR(! m.getVolWarmStartMode(), {}, "vol", "warm start mode: off by default");
+    m.setVolWarmStartMode(true);
+    OSIUNITTEST_ASSERT_ERROR(m.getVolWarmStartMode(), {}, "vol", "warm start mode: switched on");
+    m.initialSolve();
+    CoinWarmStart* ws = m.getWarmStart();
+    OSIUNITTEST_ASSERT_ERROR(dynamic_cast<OsiTestWarmStart*>(ws) != NULL, {}, "vol", "warm start mode: getWarmStart keeps the Volume state");
+
+    m.setColUpper(0, 0.0);
+    m.resolve();
+    const int warmIterations = m.getIterationCount();
+
+    OsiTestSolverInterface cold;
+    cold.loadProblem(matrix, collb, colub, obj, rowlb, rowub);
+    cold.setColUpper(0, 0.0);
+    cold.initialSolve();
+    OSIUNITTEST_ASSERT_ERROR(warmIterations < cold.getIterationCount(), {}, "vol", "warm start mode: warm re-solve takes fewer iterations");
+
+    // a solver given the warm start does the same re-solve
+    OsiTestSolverInterface restored;
+    restored.loadProblem(matrix, collb, colub, obj, rowlb, rowub);
+    restored.setColUpper(0, 0.0);
+    OSIUNITTEST_ASSERT_ERROR(restored.setWarmStart(ws), {}, "vol", "warm start mode: setWarmStart accepts the Volume state");
+    restored.resolve();
+    OSIUNITTEST_ASSERT_ERROR(restored.getIterationCount() == warmIterations, {}, "vol", "warm start mode: restored state gives the same iterations");
+    OSIUNITTEST_ASSERT_ERROR(restored.getObjValue() == m.getObjValue(), {}, "vol", "warm start mode: restored state gives the same value");
+    delete ws;
+  }
+
   // Do common solverInterface testing
   {
     OsiTestSolverInterface m;
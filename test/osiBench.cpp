@@ -0,0 +1,593 @@
+// Copyright (C) 2026
+// All Rights Reserved.
+// This file is licensed under the terms of Eclipse Public License (EPL).
+
+/*
+  Microbenchmarks for the core Osi data paths.
+
+  Each case times a single operation (inserting a cut, checking a cut for
+  violation, a presolve, ...) on synthetic data or on the models in
+  Data/Sample, using OsiTestSolverInterface as the solver. The number of
+  operations is doubled until a case runs for at least -minTime seconds; the
+  report gives ns/op and heap allocations per op (counted by replacing the
+  global operator new).
+
+  Usage: osiBench [-mpsDir=dir] [-minTime=seconds] [-filter=substring]
+                  [-save=file] [-baseline=file]
+
+  -save writes the results to a file; -baseline reads such a file and adds
+  the ratio new/old of the ns/op to the report, so a change can be measured
+  by saving before and comparing after.
+*/
+
+#include "CoinPragma.hpp"
+#include "OsiConfig.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "CoinTime.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedVector.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiTestSolverInterface.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
+#include "OsiChooseVariable.hpp"
+#include "OsiBranchingObject.hpp"
+#include "OsiPresolve.hpp"
+
+//#############################################################################
+// Allocation counting
+//#############################################################################
+
+static size_t numberAllocations = 0;
+
+#if __cplusplus >= 201103L
+#define OSIBENCH_NOTHROW noexcept
+#else
+#define OSIBENCH_NOTHROW throw()
+#endif
+
+void *operator new(size_t size)
+{
+  numberAllocations++;
+  void *p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t size)
+{
+  numberAllocations++;
+  void *p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void operator delete(void *p) OSIBENCH_NOTHROW
+{
+  free(p);
+}
+void operator delete[](void *p) OSIBENCH_NOTHROW
+{
+  free(p);
+}
+
+//#############################################################################
+// Cases
+//#############################################################################
+
+// Results of cases are added here so the work is not optimized away
+static double benchSink = 0.0;
+
+namespace {
+
+/// A benchmark case
+class OsiBenchCase {
+public:
+  OsiBenchCase(const std::string &name)
+    : name_(name)
+  {
+  }
+  virtual ~OsiBenchCase() {}
+  /// Name used in the report
+  const std::string &name() const { return name_; }
+  /// Untimed preparation; returns false if the case can not run
+  virtual bool setUp() { return true; }
+  /// Does number operations
+  virtual void run(int number) = 0;
+
+private:
+  std::string name_;
+};
+
+/// Deterministic pseudo random numbers (so runs are comparable)
+class OsiBenchRandom {
+public:
+  OsiBenchRandom(unsigned int seed = 12345)
+    : seed_(seed)
+  {
+  }
+  /// Random integer in [0,n)
+  int next(int n)
+  {
+    seed_ = 1103515245 * seed_ + 12345;
+    return static_cast< int >((seed_ >> 8) % static_cast< unsigned int >(n));
+  }
+  /// Random double in [0,1)
+  double nextDouble()
+  {
+    return next(1 << 20) / static_cast< double >(1 << 20);
+  }
+
+private:
+  unsigned int seed_;
+};
+
+/*
+  Random row cuts with size elements on numberColumns columns. Every
+  fourth cut repeats an earlier one, so duplicate checks have something
+  to find.
+*/
+void makeCuts(std::vector< OsiRowCut > &cuts, int numberCuts, int size,
+  int numberColumns)
+{
+  OsiBenchRandom random;
+  cuts.resize(numberCuts);
+  std::vector< int > indices(size);
+  std::vector< double > elements(size);
+  for (int i = 0; i < numberCuts; i++) {
+    if (i > 3 && (i % 4) == 0) {
+      cuts[i] = cuts[random.next(i)];
+      continue;
+    }
+    int start = random.next(numberColumns - size);
+    for (int j = 0; j < size; j++) {
+      indices[j] = start + j;
+      elements[j] = 1.0 + random.next(5);
+    }
+    cuts[i].setRow(size, &indices[0], &elements[0]);
+    cuts[i].setLb(-COIN_DBL_MAX);
+    cuts[i].setUb(size + random.next(size));
+  }
+}
+
+/// Reads model into a test solver; NULL if it can not be read
+OsiSolverInterface *readModel(const std::string &mpsDir, const std::string &model)
+{
+  OsiSolverInterface *si = new OsiTestSolverInterface;
+  si->messageHandler()->setLogLevel(0);
+  std::string fn = mpsDir + model;
+  if (si->readMps(fn.c_str(), "mps") != 0) {
+    delete si;
+    return NULL;
+  }
+  return si;
+}
+
+/// OsiCuts::insert or insertIfNotDuplicate of a row cut
+class CutsInsertCase : public OsiBenchCase {
+public:
+  CutsInsertCase(bool checkDuplicates)
+    : OsiBenchCase(checkDuplicates ? "cuts/insertIfNotDuplicate" : "cuts/insert")
+    , checkDuplicates_(checkDuplicates)
+  {
+  }
+  virtual bool setUp()
+  {
+    makeCuts(cuts_, 256, 10, 1000);
+    return true;
+  }
+  virtual void run(int number)
+  {
+    OsiCuts cs;
+    const int numberCuts = static_cast< int >(cuts_.size());
+    for (int i = 0; i < number; i++) {
+      if (i % numberCuts == 0)
+        cs = OsiCuts();
+      if (checkDuplicates_) {
+        OsiRowCut rc(cuts_[i % numberCuts]);
+        cs.insertIfNotDuplicate(rc);
+      } else {
+        cs.insert(cuts_[i % numberCuts]);
+      }
+    }
+    benchSink += cs.sizeRowCuts();
+  }
+
+private:
+  bool checkDuplicates_;
+  std::vector< OsiRowCut > cuts_;
+};
+
+/// OsiRowCut::violated
+class RowCutViolatedCase : public OsiBenchCase {
+public:
+  RowCutViolatedCase()
+    : OsiBenchCase("rowcut/violated")
+  {
+  }
+  virtual bool setUp()
+  {
+    makeCuts(cuts_, 256, 20, 1000);
+    OsiBenchRandom random(54321);
+    solution_.resize(1000);
+    for (int i = 0; i < 1000; i++)
+      solution_[i] = random.nextDouble();
+    return true;
+  }
+  virtual void run(int number)
+  {
+    const int numberCuts = static_cast< int >(cuts_.size());
+    double sum = 0.0;
+    for (int i = 0; i < number; i++)
+      sum += cuts_[i % numberCuts].violated(&solution_[0]);
+    benchSink += sum;
+  }
+
+private:
+  std::vector< OsiRowCut > cuts_;
+  std::vector< double > solution_;
+};
+
+/// Base for cases working on a model from Data/Sample
+class ModelCase : public OsiBenchCase {
+public:
+  ModelCase(const std::string &what, const std::string &mpsDir,
+    const std::string &model)
+    : OsiBenchCase(what + "/" + model)
+    , mpsDir_(mpsDir)
+    , model_(model)
+    , si_(NULL)
+  {
+  }
+  virtual ~ModelCase() { delete si_; }
+  virtual bool setUp()
+  {
+    si_ = readModel(mpsDir_, model_);
+    return si_ != NULL;
+  }
+
+protected:
+  std::string mpsDir_;
+  std::string model_;
+  OsiSolverInterface *si_;
+};
+
+/// OsiSolverInterface::applyCuts of 20 cuts (and deleting them again)
+class ApplyCutsCase : public ModelCase {
+public:
+  ApplyCutsCase(const std::string &mpsDir, const std::string &model)
+    : ModelCase("applyCuts", mpsDir, model)
+  {
+  }
+  virtual bool setUp()
+  {
+    if (!ModelCase::setUp())
+      return false;
+    const int numberColumns = si_->getNumCols();
+    if (numberColumns < 8)
+      return false;
+    std::vector< OsiRowCut > cuts;
+    makeCuts(cuts, 20, CoinMin(10, numberColumns / 2), numberColumns);
+    for (size_t i = 0; i < cuts.size(); i++)
+      cs_.insert(cuts[i]);
+    numberRows_ = si_->getNumRows();
+    for (int i = 0; i < cs_.sizeRowCuts(); i++)
+      added_.push_back(numberRows_ + i);
+    return true;
+  }
+  virtual void run(int number)
+  {
+    for (int i = 0; i < number; i++) {
+      OsiSolverInterface::ApplyCutsReturnCode rc = si_->applyCuts(cs_);
+      benchSink += rc.getNumApplied();
+      si_->deleteRows(si_->getNumRows() - numberRows_, &added_[0]);
+    }
+  }
+
+private:
+  OsiCuts cs_;
+  int numberRows_;
+  std::vector< int > added_;
+};
+
+/// clone (on its own and with buildCGraph on the clone)
+class CloneCase : public ModelCase {
+public:
+  CloneCase(const std::string &mpsDir, const std::string &model, bool buildCGraph)
+    : ModelCase(buildCGraph ? "clone+buildCGraph" : "clone", mpsDir, model)
+    , buildCGraph_(buildCGraph)
+  {
+  }
+  virtual void run(int number)
+  {
+    for (int i = 0; i < number; i++) {
+      OsiSolverInterface *copy = si_->clone();
+      if (buildCGraph_)
+        copy->buildCGraph();
+      benchSink += copy->getNumCols();
+      delete copy;
+    }
+  }
+
+private:
+  bool buildCGraph_;
+};
+
+/// writeLpNative followed by readLp
+class LpRoundTripCase : public ModelCase {
+public:
+  LpRoundTripCase(const std::string &mpsDir, const std::string &model)
+    : ModelCase("lpRoundTrip", mpsDir, model)
+  {
+  }
+  virtual void run(int number)
+  {
+    for (int i = 0; i < number; i++) {
+      si_->writeLpNative("osiBench.lp", NULL, NULL);
+      OsiTestSolverInterface si;
+      si.messageHandler()->setLogLevel(0);
+      si.readLp("osiBench.lp");
+      benchSink += si.getNumRows();
+    }
+  }
+};
+
+/// OsiPresolve::presolvedModel
+class PresolveCase : public ModelCase {
+public:
+  PresolveCase(const std::string &mpsDir, const std::string &model)
+    : ModelCase("presolve", mpsDir, model)
+  {
+  }
+  virtual void run(int number)
+  {
+    for (int i = 0; i < number; i++) {
+      OsiPresolve pinfo;
+      OsiSolverInterface *presolved = pinfo.presolvedModel(*si_, 1.0e-8, true, 5);
+      if (presolved)
+        benchSink += presolved->getNumRows();
+      delete presolved;
+    }
+  }
+};
+
+/*
+  OsiChooseVariable::setupList on a synthetic problem with numberColumns
+  integer columns, about half of them fractional.
+*/
+class SetupListCase : public OsiBenchCase {
+public:
+  SetupListCase()
+    : OsiBenchCase("chooseVariable/setupList")
+    , chooser_(NULL)
+  {
+  }
+  virtual ~SetupListCase() { delete chooser_; }
+  virtual bool setUp()
+  {
+    const int numberColumns = 2000;
+    const int numberRows = 200;
+    OsiBenchRandom random;
+    si_.messageHandler()->setLogLevel(0);
+    CoinPackedMatrix matrix(true, 0, 0);
+    matrix.setDimensions(0, numberColumns);
+    for (int i = 0; i < numberRows; i++) {
+      CoinPackedVector row;
+      for (int j = 0; j < 10; j++)
+        row.insert((i * 10 + j) % numberColumns, 1.0);
+      matrix.appendRow(row);
+    }
+    std::vector< double > columnLower(numberColumns, 0.0);
+    std::vector< double > columnUpper(numberColumns, 10.0);
+    std::vector< double > objective(numberColumns, 1.0);
+    std::vector< double > rowLower(numberRows, -COIN_DBL_MAX);
+    std::vector< double > rowUpper(numberRows, 20.0);
+    si_.loadProblem(matrix, &columnLower[0], &columnUpper[0], &objective[0],
+      &rowLower[0], &rowUpper[0]);
+    for (int j = 0; j < numberColumns; j++)
+      si_.setInteger(j);
+    si_.findIntegers(false);
+    std::vector< double > solution(numberColumns);
+    for (int j = 0; j < numberColumns; j++)
+      solution[j] = random.next(10) + ((j & 1) ? 0.5 * random.nextDouble() : 0.0);
+    si_.setColSolution(&solution[0]);
+    chooser_ = new OsiChooseVariable(&si_);
+    return true;
+  }
+  virtual void run(int number)
+  {
+    OsiBranchingInformation info(&si_, true, false);
+    for (int i = 0; i < number; i++)
+      benchSink += chooser_->setupList(&info, true);
+  }
+
+private:
+  OsiTestSolverInterface si_;
+  OsiChooseVariable *chooser_;
+};
+
+/// setRowName/getRowName with name discipline 2 (lazy names off)
+class NamesCase : public OsiBenchCase {
+public:
+  NamesCase(bool set)
+    : OsiBenchCase(set ? "names/setRowName" : "names/getRowName")
+    , set_(set)
+  {
+  }
+  virtual bool setUp()
+  {
+    const int numberColumns = 100;
+    const int numberRows = 1000;
+    CoinPackedMatrix matrix(true, 0, 0);
+    matrix.setDimensions(0, numberColumns);
+    for (int i = 0; i < numberRows; i++) {
+      CoinPackedVector row;
+      row.insert(i % numberColumns, 1.0);
+      matrix.appendRow(row);
+    }
+    std::vector< double > columnLower(numberColumns, 0.0);
+    std::vector< double > columnUpper(numberColumns, 1.0);
+    std::vector< double > objective(numberColumns, 1.0);
+    std::vector< double > rowLower(numberRows, 0.0);
+    std::vector< double > rowUpper(numberRows, 1.0);
+    si_.loadProblem(matrix, &columnLower[0], &columnUpper[0], &objective[0],
+      &rowLower[0], &rowUpper[0]);
+    si_.setIntParam(OsiNameDiscipline, 2);
+    char name[20];
+    for (int i = 0; i < numberRows; i++) {
+      sprintf(name, "row_%d", i);
+      names_.push_back(name);
+      si_.setRowName(i, name);
+    }
+    return true;
+  }
+  virtual void run(int number)
+  {
+    const int numberRows = static_cast< int >(names_.size());
+    size_t length = 0;
+    for (int i = 0; i < number; i++) {
+      int iRow = i % numberRows;
+      if (set_)
+        si_.setRowName(iRow, names_[iRow]);
+      else
+        length += si_.getRowName(iRow).size();
+    }
+    benchSink += static_cast< double >(length);
+  }
+
+private:
+  bool set_;
+  OsiTestSolverInterface si_;
+  std::vector< std::string > names_;
+};
+
+/// Result of a case
+struct BenchResult {
+  double nsPerOp;
+  double allocationsPerOp;
+};
+
+/*
+  Runs a case with a doubling number of operations until it takes at least
+  minTime seconds.
+*/
+BenchResult runCase(OsiBenchCase &benchCase, double minTime)
+{
+  BenchResult result;
+  int number = 1;
+  while (true) {
+    size_t allocationsBefore = numberAllocations;
+    double startTime = CoinWallclockTime();
+    benchCase.run(number);
+    double elapsed = CoinWallclockTime() - startTime;
+    if (elapsed >= minTime || number >= (1 << 30)) {
+      result.nsPerOp = 1.0e9 * elapsed / number;
+      result.allocationsPerOp = static_cast< double >(numberAllocations - allocationsBefore) / number;
+      break;
+    }
+    number *= 2;
+  }
+  return result;
+}
+
+} // namespace
+
+//#############################################################################
+
+int main(int argc, const char *argv[])
+{
+  std::map< std::string, std::string > parms;
+  parms["-mpsDir"] = "../../Data/Sample";
+  parms["-minTime"] = "0.2";
+  for (int i = 1; i < argc; i++) {
+    std::string parm(argv[i]);
+    std::string::size_type eqPos = parm.find('=');
+    std::string key = parm.substr(0, eqPos);
+    if (key != "-mpsDir" && key != "-minTime" && key != "-filter"
+      && key != "-save" && key != "-baseline") {
+      std::cerr << "Usage: osiBench [-mpsDir=dir] [-minTime=seconds] [-filter=substring] [-save=file] [-baseline=file]" << std::endl;
+      return 1;
+    }
+    parms[key] = eqPos == std::string::npos ? "" : parm.substr(eqPos + 1);
+  }
+  std::string mpsDir = parms["-mpsDir"];
+  if (mpsDir.length() > 0)
+    mpsDir += CoinFindDirSeparator();
+  double minTime = atof(parms["-minTime"].c_str());
+  std::string filter = parms["-filter"];
+
+  // results of an earlier run
+  std::map< std::string, BenchResult > baseline;
+  if (parms["-baseline"].length() > 0) {
+    std::ifstream in(parms["-baseline"].c_str());
+    if (!in) {
+      std::cerr << "Unable to read baseline " << parms["-baseline"] << std::endl;
+      return 1;
+    }
+    std::string name;
+    BenchResult result;
+    while (in >> name >> result.nsPerOp >> result.allocationsPerOp)
+      baseline[name] = result;
+  }
+
+  std::vector< OsiBenchCase * > cases;
+  cases.push_back(new CutsInsertCase(false));
+  cases.push_back(new CutsInsertCase(true));
+  cases.push_back(new RowCutViolatedCase());
+  cases.push_back(new SetupListCase());
+  cases.push_back(new NamesCase(true));
+  cases.push_back(new NamesCase(false));
+  const char *models[] = { "exmip1", "p0033", "p0201", "brandy" };
+  for (size_t m = 0; m < sizeof(models) / sizeof(models[0]); m++) {
+    cases.push_back(new ApplyCutsCase(mpsDir, models[m]));
+    cases.push_back(new CloneCase(mpsDir, models[m], false));
+    cases.push_back(new CloneCase(mpsDir, models[m], true));
+    cases.push_back(new LpRoundTripCase(mpsDir, models[m]));
+    cases.push_back(new PresolveCase(mpsDir, models[m]));
+  }
+
+  std::ofstream save;
+  if (parms["-save"].length() > 0)
+    save.open(parms["-save"].c_str());
+
+  printf("%-36s %14s %12s", "case", "ns/op", "allocs/op");
+  if (!baseline.empty())
+    printf(" %10s", "vs base");
+  printf("\n");
+  for (size_t i = 0; i < cases.size(); i++) {
+    OsiBenchCase &benchCase = *cases[i];
+    if (filter.length() > 0 && benchCase.name().find(filter) == std::string::npos)
+      continue;
+    if (!benchCase.setUp()) {
+      printf("%-36s %14s\n", benchCase.name().c_str(), "skipped");
+      continue;
+    }
+    BenchResult result = runCase(benchCase, minTime);
+    printf("%-36s %14.1f %12.2f", benchCase.name().c_str(),
+      result.nsPerOp, result.allocationsPerOp);
+    std::map< std::string, BenchResult >::const_iterator old = baseline.find(benchCase.name());
+    if (old != baseline.end() && old->second.nsPerOp > 0.0)
+      printf(" %10.3f", result.nsPerOp / old->second.nsPerOp);
+    printf("\n");
+    if (save.is_open())
+      save << benchCase.name() << " " << result.nsPerOp << " "
+           << result.allocationsPerOp << std::endl;
+  }
+  for (size_t i = 0; i < cases.size(); i++)
+    delete cases[i];
+  remove("osiBench.lp");
+  return benchSink == -1.0 ? 1 : 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -392,9 +392,13 @@ int main (int argc, const char *argv[])
     }
 #   endif
 
+    int numberThreads = 1;
+    if (parms.find("-threads") != parms.end())
+      numberThreads = atoi(parms["-threads"].c_str());
+
     if (vecSi.size() > 0)
     { testingMessage( "Testing OsiSolverInterface on Netlib problems.\n" );
-      OSIUNITTEST_CATCH_ERROR(OsiSolverInterfaceMpsUnitTest(vecSi,netlibDir), {}, "osi", "netlib unittest");
+      OSIUNITTEST_CATCH_ERROR(OsiSolverInterfaceMpsUnitTest(vecSi,netlibDir,numberThreads), {}, "osi", "netlib unittest");
     }
 
     unsigned int i;